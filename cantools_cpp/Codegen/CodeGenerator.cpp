@@ -0,0 +1,503 @@
+/**
+ * @file CodeGenerator.cpp
+ * @brief Implementation of the CodeGenerator class producing constexpr pack/unpack structs from a CAN bus.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <filesystem>
+#include <unordered_map>
+#include <unordered_set>
+#include "CodeGenerator.hpp"
+#include "CANBus.hpp"
+#include "BitKernel.hpp"
+#include "CANSignal.hpp"
+#include "Logger.hpp"
+
+namespace cantools_cpp
+{
+    namespace
+    {
+        using SignalNames = std::unordered_map<const CANSignal*, std::string>;
+
+        /**
+         * @brief Names that cannot be used as identifiers in the generated header.
+         */
+        const std::unordered_set<std::string>& reservedNames() {
+            static const std::unordered_set<std::string> names = {
+                "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break", "case", "catch",
+                "char", "char8_t", "char16_t", "char32_t", "class", "compl", "concept", "const", "consteval", "constexpr",
+                "constinit", "const_cast", "continue", "co_await", "co_return", "co_yield", "decltype", "default", "delete",
+                "do", "double", "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false", "float", "for",
+                "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq",
+                "nullptr", "operator", "or", "or_eq", "private", "protected", "public", "register", "reinterpret_cast",
+                "requires", "return", "short", "signed", "sizeof", "static", "static_assert", "static_cast", "struct",
+                "switch", "template", "this", "thread_local", "throw", "true", "try", "typedef", "typeid", "typename",
+                "union", "unsigned", "using", "virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq",
+                // Types used by the generated code
+                "std", "int8_t", "int16_t", "int32_t", "int64_t", "uint8_t", "uint16_t", "uint32_t", "uint64_t"
+            };
+            return names;
+        }
+
+        /**
+         * @brief Turns a DBC name into a valid C++ identifier.
+         *
+         * Characters other than letters, digits and '_' become '_'. Names starting with a digit, empty names
+         * and keywords get a "dbc_" prefix.
+         */
+        std::string identifier(const std::string& name) {
+            std::string result = name;
+            for (char& c : result) {
+                if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') {
+                    c = '_';
+                }
+            }
+            if (result.empty() || std::isdigit(static_cast<unsigned char>(result[0])) || reservedNames().count(result)) {
+                result = "dbc_" + result;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Turns a DBC name into a valid C++ identifier that is not already taken, and records it.
+         *
+         * A numbered suffix is added on collisions. Renamed objects are logged, as the generated names then
+         * differ from the DBC file.
+         *
+         * @param what The object being named, for the log.
+         */
+        std::string uniqueIdentifier(const std::string& name, std::unordered_set<std::string>& taken, const std::string& what) {
+            std::string base = identifier(name);
+            std::string result = base;
+            for (int suffix = 2; taken.count(result); ++suffix) {
+                result = base + "_" + std::to_string(suffix);
+            }
+            taken.insert(result);
+
+            if (result != name) {
+                Logger::getInstance().log("Warning: " + what + " is named " + result + " in the generated code", Logger::LOG_WARNING);
+            }
+            return result;
+        }
+
+        /**
+         * @brief Makes a DBC text (unit, node name, ...) safe to embed in a doc comment.
+         */
+        std::string commentText(std::string text) {
+            for (size_t pos = text.find("*/"); pos != std::string::npos; pos = text.find("*/", pos)) {
+                text.replace(pos, 2, "* /");
+            }
+            std::replace(text.begin(), text.end(), '\n', ' ');
+            return text;
+        }
+
+        /**
+         * @brief Formats a DBC name as a string literal.
+         */
+        std::string stringLiteral(const std::string& text) {
+            std::string result = "\"";
+            for (char c : text) {
+                if (c == '"' || c == '\\') {
+                    result += '\\';
+                }
+                result += c;
+            }
+            return result + "\"";
+        }
+
+        /**
+         * @brief Returns the smallest unsigned type holding the given number of bits.
+         */
+        std::string rawType(int length) {
+            if (length <= 8) return "uint8_t";
+            if (length <= 16) return "uint16_t";
+            if (length <= 32) return "uint32_t";
+            return "uint64_t";
+        }
+
+        /**
+         * @brief Returns the type of the struct field holding a signal.
+         *
+         * Signed signals are stored sign extended, float and double signals keep their IEEE 754 bit pattern.
+         */
+        std::string fieldType(const CANSignal& signal) {
+            switch (signal.getValueType()) {
+            case Signed: {
+                std::string type = rawType(signal.getLength());
+                return type.substr(1);
+            }
+            case IEEEFloat:
+                return "uint32_t";
+            case IEEEDouble:
+                return "uint64_t";
+            default:
+                return rawType(signal.getLength());
+            }
+        }
+
+        /**
+         * @brief Returns the mask covering the bits of a signal.
+         */
+        uint64_t rawMask(const CANSignal& signal) {
+            return signal.getLength() >= 64 ? ~0ULL : (1ULL << signal.getLength()) - 1;
+        }
+
+        /**
+         * @brief Formats a double so that it reads back to the same value.
+         */
+        std::string literal(double value) {
+            std::ostringstream oss;
+            oss << std::setprecision(17) << value;
+            std::string text = oss.str();
+            if (text.find_first_of(".eEn") == std::string::npos) {
+                text += ".0";
+            }
+            return text;
+        }
+
+        /**
+         * @brief Formats an unsigned mask as a hexadecimal literal.
+         */
+        std::string hex(uint64_t value) {
+            std::ostringstream oss;
+            oss << "0x" << std::uppercase << std::hex << value << "u";
+            return oss.str();
+        }
+
+        /**
+         * @brief Returns the number of multiplexors a signal depends on, directly or not.
+         */
+        int multiplexingDepth(const CANSignal& signal) {
+            int depth = 0;
+            for (auto multiplexor = signal.isMultiplexed() ? signal.getMultiplexorSignal() : nullptr; multiplexor;
+                multiplexor = multiplexor->isMultiplexed() ? multiplexor->getMultiplexorSignal() : nullptr) {
+                ++depth;
+            }
+            return depth;
+        }
+
+        /**
+         * @brief Returns the condition under which a signal is present in the frame, empty for plain signals.
+         *
+         * The raw multiplexor field is compared with the multiplexer values, nested multiplexors add their own condition.
+         */
+        std::string activeCondition(const CANSignal& signal, const SignalNames& names) {
+            auto multiplexor = signal.isMultiplexed() ? signal.getMultiplexorSignal() : nullptr;
+            if (!multiplexor) {
+                return "";
+            }
+
+            std::string value = "static_cast<uint64_t>(" + names.at(multiplexor.get()) + ")";
+            if (multiplexor->getValueType() == Signed) {
+                value = "(" + value + " & " + hex(rawMask(*multiplexor)) + ")";
+            }
+
+            const auto& ranges = signal.getMultiplexerValues();
+            std::string condition;
+            for (const MultiplexerRange& range : ranges) {
+                if (!condition.empty()) {
+                    condition += " || ";
+                }
+                if (range.low == range.high) {
+                    condition += value + " == " + hex(range.low);
+                }
+                else if (range.low == 0) {
+                    condition += value + " <= " + hex(range.high);
+                }
+                else {
+                    condition += "(" + value + " >= " + hex(range.low) + " && " + value + " <= " + hex(range.high) + ")";
+                }
+            }
+            if (ranges.size() > 1) {
+                condition = "(" + condition + ")";
+            }
+
+            std::string parent = activeCondition(*multiplexor, names);
+            return parent.empty() ? condition : parent + " && " + condition;
+        }
+    }
+
+    CodeGenerator::CodeGenerator(std::shared_ptr<CANBus> bus) : _bus(bus) {}
+
+    std::vector<CodeGenerator::ByteSlice> CodeGenerator::sliceSignal(const CANSignal& signal, int frameLength)
+    {
+        std::vector<ByteSlice> slices;
+
+        bool motorola = signal.getByteOrder() != ByteOrder_LSB;
+        int frameBits = 8 * frameLength;
+        int lsb = motorola ? BitKernel::motorolaStartBit(signal.getStartBit(), signal.getLength(), frameLength) : signal.getStartBit();
+
+        if (lsb < 0 || lsb >= frameBits) {
+            return slices;
+        }
+
+        // Motorola signals are little endian bit streams of the mirrored frame
+        int length = std::min<int>(signal.getLength(), frameBits - lsb);
+        for (int i = 0; i < length;) {
+            int streamBit = lsb + i;
+            ByteSlice slice;
+            slice.bitInByte = streamBit % 8;
+            slice.width = std::min(8 - slice.bitInByte, length - i);
+            slice.byte = motorola ? frameLength - 1 - streamBit / 8 : streamBit / 8;
+            slice.signalBit = i;
+            slices.push_back(slice);
+            i += slice.width;
+        }
+
+        return slices;
+    }
+
+    std::string CodeGenerator::generateMessage(CANMessage& message, const std::string& structName) const
+    {
+        std::ostringstream out;
+        int length = message.getLength();
+        const auto& signals = message.getSignals();
+
+        // Fields may not be named like the struct nor like its other members
+        std::unordered_set<std::string> taken = { structName, "MESSAGE_ID", "MESSAGE_LENGTH", "decode", "encode", "visit", "visitPhysical" };
+        SignalNames names;
+        for (const auto& signal : signals) {
+            names[signal.get()] = uniqueIdentifier(signal->getName(), taken, "Signal " + message.getName() + "." + signal->getName());
+        }
+
+        out << "    /**\n";
+        out << "     * @brief Message " << commentText(message.getName()) << " (ID " << message.getId() << ", " << length << " bytes), sent by "
+            << commentText(message.getTransmitter()) << ".\n";
+        out << "     */\n";
+        out << "    struct " << structName << " {\n";
+        out << "        static constexpr uint32_t MESSAGE_ID = " << message.getId() << "u;\n";
+        out << "        static constexpr int MESSAGE_LENGTH = " << length << ";\n\n";
+
+        for (const auto& signal : signals) {
+            out << "        " << fieldType(*signal) << " " << names[signal.get()] << " = 0;  ///< Raw value";
+            if (!signal->getUnit().empty()) {
+                out << ", physical unit " << commentText(signal->getUnit());
+            }
+            out << "\n";
+        }
+
+        out << "\n        /**\n";
+        out << "         * @brief Decodes the raw values from a frame of MESSAGE_LENGTH bytes.\n";
+        out << "         *\n";
+        out << "         * Multiplexed signals are only decoded when present, the other ones keep their values.\n";
+        out << "         */\n";
+        out << "        constexpr void decode(const uint8_t* data) noexcept {\n";
+
+        // Multiplexors are decoded before the signals depending on them
+        auto ordered = signals;
+        std::stable_sort(ordered.begin(), ordered.end(), [](const std::shared_ptr<CANSignal>& a, const std::shared_ptr<CANSignal>& b) {
+            return multiplexingDepth(*a) < multiplexingDepth(*b);
+            });
+
+        for (const auto& signal : ordered) {
+            auto slices = sliceSignal(*signal, length);
+            bool isSigned = signal->getValueType() == Signed;
+            std::string condition = activeCondition(*signal, names);
+            std::string indent = condition.empty() ? "            " : "                ";
+            if (!condition.empty()) {
+                out << "            if (" << condition << ") {\n";
+            }
+            out << indent << names[signal.get()] << " = static_cast<" << fieldType(*signal) << ">(";
+            if (isSigned) {
+                out << "static_cast<int64_t>(((";
+            }
+            if (slices.empty()) {
+                out << "0";
+            }
+            for (size_t i = 0; i < slices.size(); ++i) {
+                const ByteSlice& slice = slices[i];
+                if (i > 0) {
+                    out << "\n" << indent << "    | ";
+                }
+                out << "(static_cast<uint64_t>((data[" << slice.byte << "] >> " << slice.bitInByte << ") & " << hex((1u << slice.width) - 1) << ") << " << slice.signalBit << ")";
+            }
+            if (isSigned) {
+                // Branchless sign extension, as the runtime decoder does
+                uint64_t signBit = rawMask(*signal) ^ (rawMask(*signal) >> 1);
+                out << ")\n" << indent << "    ^ " << hex(signBit) << ") - " << hex(signBit) << ")";
+            }
+            out << ");\n";
+            if (!condition.empty()) {
+                out << "            }\n";
+            }
+        }
+        out << "        }\n\n";
+
+        out << "        /**\n";
+        out << "         * @brief Encodes the raw values into a frame of MESSAGE_LENGTH bytes.\n";
+        out << "         *\n";
+        out << "         * Bits not covered by any signal are cleared and the signals are written in declaration order, each one\n";
+        out << "         * replacing the bits it covers, so that overlapping signals end up as with CANMessage::pack.\n";
+        out << "         * Multiplexed signals are only encoded when present for the multiplexor values.\n";
+        out << "         */\n";
+        out << "        constexpr void encode(uint8_t* data) const noexcept {\n";
+        out << "            for (int i = 0; i < MESSAGE_LENGTH; ++i) {\n";
+        out << "                data[i] = 0;\n";
+        out << "            }\n";
+        for (const auto& signal : signals) {
+            std::string condition = activeCondition(*signal, names);
+            std::string indent = condition.empty() ? "            " : "                ";
+            if (!condition.empty()) {
+                out << "            if (" << condition << ") {\n";
+            }
+            for (const ByteSlice& slice : sliceSignal(*signal, length)) {
+                uint32_t byteMask = ((1u << slice.width) - 1) << slice.bitInByte;
+                std::string bits = "((static_cast<uint64_t>(" + names[signal.get()] + ") >> " + std::to_string(slice.signalBit) + ") << "
+                    + std::to_string(slice.bitInByte) + ") & " + hex(byteMask);
+                if (byteMask == 0xFFu) {
+                    out << indent << "data[" << slice.byte << "] = static_cast<uint8_t>(" << bits << ");\n";
+                }
+                else {
+                    out << indent << "data[" << slice.byte << "] = static_cast<uint8_t>((data[" << slice.byte << "] & " << hex(~byteMask & 0xFFu) << ") | (" << bits << "));\n";
+                }
+            }
+            if (!condition.empty()) {
+                out << "            }\n";
+            }
+        }
+        out << "        }\n";
+
+        for (const auto& signal : signals) {
+            const std::string& name = names[signal.get()];
+            std::string factor = literal(signal->getFactor());
+            std::string offset = literal(signal->getOffset());
+            DbcValueType valueType = signal->getValueType();
+
+            out << "\n        /**\n";
+            out << "         * @brief Physical value of " << name << ".\n";
+            out << "         */\n";
+            if (valueType == IEEEFloat || valueType == IEEEDouble) {
+                // Bit casts are not constexpr before C++20
+                std::string type = valueType == IEEEFloat ? "float" : "double";
+                out << "        double getPhysical_" << name << "() const noexcept {\n";
+                out << "            " << type << " value;\n";
+                out << "            std::memcpy(&value, &" << name << ", sizeof(value));\n";
+                out << "            return static_cast<double>(value) * " << factor << " + " << offset << ";\n";
+                out << "        }\n\n";
+
+                out << "        /**\n";
+                out << "         * @brief Sets " << name << " from a physical value.\n";
+                out << "         */\n";
+                out << "        void setPhysical_" << name << "(double value) noexcept {\n";
+                out << "            " << type << " raw = static_cast<" << type << ">((value - " << offset << ") / " << factor << ");\n";
+                out << "            std::memcpy(&" << name << ", &raw, sizeof(raw));\n";
+                out << "        }\n";
+                continue;
+            }
+
+            out << "        constexpr double getPhysical_" << name << "() const noexcept {\n";
+            out << "            return static_cast<double>(" << name << ") * " << factor << " + " << offset << ";\n";
+            out << "        }\n\n";
+
+            out << "        /**\n";
+            out << "         * @brief Sets " << name << " from a physical value, rounded to the nearest raw value and capped to its range.\n";
+            out << "         */\n";
+            out << "        constexpr void setPhysical_" << name << "(double value) noexcept {\n";
+            out << "            double raw = (value - " << offset << ") / " << factor << ";\n";
+
+            // Rounds half away from zero as std::round, which is not constexpr; from 2^52 on every double is whole
+            out << "            if (raw > -4503599627370496.0 && raw < 4503599627370496.0) {\n";
+            out << "                double whole = static_cast<double>(static_cast<int64_t>(raw));\n";
+            out << "                raw = raw - whole >= 0.5 ? whole + 1.0 : raw - whole <= -0.5 ? whole - 1.0 : whole;\n";
+            out << "            }\n";
+            if (valueType == Signed) {
+                uint64_t maxRaw = rawMask(*signal) >> 1;
+                std::string limit = literal(std::ldexp(1.0, signal->getLength() - 1));
+                out << "            " << name << " = static_cast<" << fieldType(*signal) << ">(raw != raw ? 0 : raw >= " << limit << " ? " << static_cast<int64_t>(maxRaw)
+                    << "LL : raw < -" << limit << " ? -" << static_cast<int64_t>(maxRaw) << "LL - 1 : static_cast<int64_t>(raw));\n";
+            }
+            else {
+                uint64_t maxRaw = rawMask(*signal);
+                out << "            " << name << " = static_cast<" << fieldType(*signal) << ">(!(raw > 0.0) ? 0u : raw >= " << literal(std::ldexp(1.0, signal->getLength()))
+                    << " ? " << hex(maxRaw) << " : static_cast<uint64_t>(raw));\n";
+            }
+            out << "        }\n";
+        }
+
+        for (const char* qualifier : { "", " const" }) {
+            out << "\n        /**\n";
+            out << "         * @brief Calls visitor(name, field) for each signal, with its name in the DBC file.\n";
+            out << "         */\n";
+            out << "        template <typename Visitor>\n";
+            out << "        constexpr void visit(Visitor&& visitor)" << qualifier << " {\n";
+            for (const auto& signal : signals) {
+                out << "            visitor(" << stringLiteral(signal->getName()) << ", " << names[signal.get()] << ");\n";
+            }
+            out << "        }\n";
+        }
+
+        out << "\n        /**\n";
+        out << "         * @brief Calls visitor(name, getPhysical, setPhysical) for each signal, with pointers to its physical value accessors.\n";
+        out << "         */\n";
+        out << "        template <typename Visitor>\n";
+        out << "        static constexpr void visitPhysical(Visitor&& visitor) {\n";
+        for (const auto& signal : signals) {
+            const std::string& name = names[signal.get()];
+            out << "            visitor(" << stringLiteral(signal->getName()) << ", &" << structName << "::getPhysical_" << name << ", &" << structName
+                << "::setPhysical_" << name << ");\n";
+        }
+        out << "        }\n";
+
+        out << "    };\n";
+        return out.str();
+    }
+
+    std::string CodeGenerator::generateHeader() const
+    {
+        std::ostringstream out;
+        std::string busName = _bus->getName();
+
+        out << "/**\n";
+        out << " * @file " << busName << ".hpp\n";
+        out << " * @brief Pack/unpack structs for the messages of the " << busName << " bus.\n";
+        out << " *\n";
+        out << " * Generated by cantools_codegen, do not edit.\n";
+        out << " */\n\n";
+        out << "#pragma once\n\n";
+        out << "#include <cstdint>\n";
+        out << "#include <cstring>\n\n";
+        out << "namespace " << identifier(busName) << "\n{\n";
+
+        std::unordered_set<std::string> taken = { "forEachMessage" };
+        std::vector<std::string> structNames;
+        for (const auto& message : _bus->getAllMessages()) {
+            structNames.push_back(uniqueIdentifier(message->getName(), taken, "Message " + message->getName()));
+            out << generateMessage(*message, structNames.back()) << "\n";
+        }
+
+        out << "    /**\n";
+        out << "     * @brief Calls visitor(message) with a default constructed struct of each message of the bus.\n";
+        out << "     */\n";
+        out << "    template <typename Visitor>\n";
+        out << "    constexpr void forEachMessage(Visitor&& visitor) {\n";
+        for (const std::string& structName : structNames) {
+            out << "        visitor(" << structName << "{});\n";
+        }
+        out << "    }\n";
+        out << "}\n";
+        return out.str();
+    }
+
+    bool CodeGenerator::writeHeader(const std::string& directory) const
+    {
+        std::filesystem::path path = std::filesystem::path(directory) / (_bus->getName() + ".hpp");
+        std::ofstream file(path);
+
+        if (!file.is_open()) {
+            Logger::getInstance().log("Error: Could not write file " + path.string(), Logger::LOG_ERROR);
+            return false;
+        }
+
+        file << generateHeader();
+        Logger::getInstance().log("Generated " + path.string(), Logger::LOG_INFO);
+        return true;
+    }
+}
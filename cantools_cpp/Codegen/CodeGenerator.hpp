@@ -0,0 +1,82 @@
+/**
+ * @file CodeGenerator.hpp
+ * @brief Declaration of the CodeGenerator class that turns a loaded CAN bus into a C++ header.
+ *
+ * The generated header contains one plain struct per CANMessage holding the raw signal values, with
+ * constexpr decode/encode functions whose byte indices, shifts and masks are compile time constants,
+ * and inline physical value accessors. It has no dependency on this library, so ECU and HIL code can
+ * decode frames without a runtime database. Names that are not valid or not unique C++ identifiers
+ * are renamed, with a warning; visit(), visitPhysical() and forEachMessage() give access to the signals
+ * by their DBC names.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cantools_cpp
+{
+    class CANBus;
+    class CANMessage;
+    class CANSignal;
+
+    class CodeGenerator {
+    public:
+        /**
+         * @brief Part of a signal lying in a single byte of the frame.
+         */
+        struct ByteSlice {
+            int byte;         ///< Byte index in the frame.
+            int bitInByte;    ///< Position of the slice LSB in the byte.
+            int width;        ///< Number of bits of the slice.
+            int signalBit;    ///< Position of the slice LSB in the signal value.
+        };
+
+        /**
+         * @brief Constructs a generator for a built CAN bus.
+         *
+         * @param bus The bus to generate code for.
+         */
+        explicit CodeGenerator(std::shared_ptr<CANBus> bus);
+
+        /**
+         * @brief Generates the header for the whole bus.
+         *
+         * @return The content of the header.
+         */
+        std::string generateHeader() const;
+
+        /**
+         * @brief Writes the generated header as <busName>.hpp in the given directory.
+         *
+         * @param directory The output directory.
+         * @return true if the file was written.
+         */
+        bool writeHeader(const std::string& directory) const;
+
+        /**
+         * @brief Splits a signal into its per byte slices, in the same layout as the runtime decoder.
+         *
+         * @param signal The signal to split.
+         * @param frameLength The data length of the message in bytes.
+         * @return The slices, from the signal LSB upwards.
+         */
+        static std::vector<ByteSlice> sliceSignal(const CANSignal& signal, int frameLength);
+
+    private:
+        /**
+         * @brief Generates the struct of one message.
+         *
+         * @param message The message to generate.
+         * @param structName The C++ name of the struct, the message name made a valid and unique identifier.
+         */
+        std::string generateMessage(CANMessage& message, const std::string& structName) const;
+
+        std::shared_ptr<CANBus> _bus;  ///< The bus to generate code for.
+    };
+}
@@ -0,0 +1,37 @@
+// main.cpp : Entry point of cantools_codegen, generating a C++ header per DBC file.
+//
+// Usage: cantools_codegen <output directory> <file.dbc>...
+
+#include <iostream>
+#include <filesystem>
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "Parser.hpp"
+#include "CodeGenerator.hpp"
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <output directory> <file.dbc>..." << std::endl;
+        return 1;
+    }
+
+    auto busManager = std::make_shared<cantools_cpp::CANBusManager>();
+    cantools_cpp::Parser parser(busManager);
+
+    int ret = 0;
+    for (int i = 2; i < argc; ++i) {
+        if (!parser.loadDBC(argv[i])) {
+            std::cerr << "Could not load " << argv[i] << std::endl;
+            ret = 1;
+            continue;
+        }
+
+        std::string busName = std::filesystem::path(argv[i]).stem().string();
+        cantools_cpp::CodeGenerator generator(busManager->getBus(busName));
+        if (!generator.writeHeader(argv[1])) {
+            ret = 1;
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,244 @@
+/**
+ * @file BitKernel.hpp
+ * @brief Word-wide bit extraction kernel for Intel and Motorola signals in CAN and CAN FD frames.
+ *
+ * A signal of at most 64 bits never spans more than 9 consecutive bytes, so any signal of a frame of
+ * any length (up to 64 bytes for CAN FD) can be extracted with one unaligned 64 bit load, an optional
+ * byte swap for Motorola signals, a shift and a mask, plus one spill byte for the rare signals longer
+ * than 57 bits. The frame itself is never copied nor mirrored. Encoding is the same read-modify-write
+ * in reverse, touching only the bits of the signal.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
+namespace cantools_cpp
+{
+    class BitKernel {
+    public:
+        /**
+         * @brief Precomputed location of a signal inside a frame of a fixed length.
+         */
+        struct Window {
+            uint64_t mask;        ///< Mask of the signal bits once shifted down.
+            uint64_t spillMask;   ///< Mask of the bits contributed by the spill byte (0 when there is none).
+            uint16_t wordOffset;  ///< Byte offset of the 64 bit word holding the signal.
+            uint16_t spillByte;   ///< Byte holding the bits that do not fit in the word.
+            uint8_t shift;        ///< Position of the signal LSB inside the loaded word.
+            uint8_t spillShift;   ///< Position of the spill byte relative to the signal LSB.
+            bool motorola;        ///< Whether the word has to be loaded big endian.
+        };
+
+        /**
+         * @brief Reverses the byte order of a 64 bit word.
+         * @param value The word to swap.
+         * @return The byte swapped word.
+         */
+        static inline uint64_t byteSwap64(uint64_t value) {
+#if defined(_MSC_VER)
+            return _byteswap_uint64(value);
+#else
+            return __builtin_bswap64(value);
+#endif
+        }
+
+        /**
+         * @brief Loads 8 bytes as a little endian 64 bit word, regardless of alignment.
+         * @param data Pointer to the first byte.
+         * @return The loaded word.
+         */
+        static inline uint64_t loadLE64(const uint8_t* data) {
+            uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = byteSwap64(value);
+#endif
+            return value;
+        }
+
+        /**
+         * @brief Stores a 64 bit word as 8 little endian bytes, regardless of alignment.
+         * @param data Pointer to the first byte.
+         * @param value The word to store.
+         */
+        static inline void storeLE64(uint8_t* data, uint64_t value) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = byteSwap64(value);
+#endif
+            std::memcpy(data, &value, sizeof(value));
+        }
+
+        /**
+         * @brief Converts a Motorola start bit (DBC sawtooth numbering) into the start bit of the signal
+         *        within the byte mirrored frame, read as a little endian bit stream.
+         * @param startBit The DBC start bit of the signal (its most significant bit).
+         * @param length The length of the signal in bits.
+         * @param frameLength The number of bytes in the frame.
+         * @return The start bit in the mirrored frame, negative if the signal does not fit.
+         */
+        static inline int motorolaStartBit(int startBit, int length, int frameLength) {
+            int startByte = startBit / 8;
+            return 8 * frameLength - length - 8 * startByte - ((8 * (startByte + 1) - startBit - 1) % 8);
+        }
+
+        /**
+         * @brief Locates a signal inside a frame.
+         *
+         * Bits lying outside of the frame are dropped, the same way the legacy bit-by-bit extraction
+         * stops at the end of the frame.
+         *
+         * @param startBit The DBC start bit of the signal.
+         * @param length The length of the signal in bits (1..64).
+         * @param motorola Whether the signal is big endian.
+         * @param frameLength The number of bytes in the frame.
+         * @return The window describing how to extract the signal.
+         */
+        static inline Window locate(int startBit, int length, bool motorola, int frameLength) {
+            Window window{};
+            window.motorola = motorola;
+
+            int frameBits = 8 * frameLength;
+            int lsb = motorola ? motorolaStartBit(startBit, length, frameLength) : startBit;
+
+            if (lsb < 0 || lsb >= frameBits) {
+                // Nothing of the signal lies inside the frame, it always extracts to 0
+                return window;
+            }
+
+            length = std::min(length, frameBits - lsb);
+            window.mask = length >= 64 ? ~0ULL : (1ULL << length) - 1;
+
+            int wordOffset;
+            int spillByte;
+            if (motorola) {
+                // Least significant byte of the signal, counted in the original byte order
+                int lastByte = frameLength - 1 - lsb / 8;
+                wordOffset = std::max(0, lastByte - 7);
+                window.shift = static_cast<uint8_t>(lsb - 8 * (frameLength - 8 - wordOffset));
+                spillByte = wordOffset - 1;
+            }
+            else {
+                wordOffset = std::max(0, std::min(lsb / 8, frameLength - 8));
+                window.shift = static_cast<uint8_t>(lsb - 8 * wordOffset);
+                spillByte = wordOffset + 8;
+            }
+
+            window.wordOffset = static_cast<uint16_t>(wordOffset);
+            window.spillByte = static_cast<uint16_t>(wordOffset);
+
+            if (window.shift + length > 64) {
+                window.spillByte = static_cast<uint16_t>(spillByte);
+                window.spillShift = static_cast<uint8_t>(64 - window.shift);
+                window.spillMask = window.mask;
+            }
+
+            return window;
+        }
+
+        /**
+         * @brief Sign extends a raw value without branching.
+         * @param raw The raw bit pattern of the signal.
+         * @param signBit The sign bit of the signal, or 0 to leave the value unsigned.
+         * @return The two's complement value.
+         */
+        static inline int64_t signExtend(uint64_t raw, uint64_t signBit) {
+            return static_cast<int64_t>((raw ^ signBit) - signBit);
+        }
+
+        /**
+         * @brief Reinterprets the low 32 bits of a raw value as an IEEE 754 single precision float.
+         * @param raw The raw bit pattern of the signal.
+         * @return The float value.
+         */
+        static inline float toFloat(uint64_t raw) {
+            uint32_t bits = static_cast<uint32_t>(raw);
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        /**
+         * @brief Reinterprets a raw value as an IEEE 754 double precision float.
+         * @param raw The raw bit pattern of the signal.
+         * @return The double value.
+         */
+        static inline double toDouble(uint64_t raw) {
+            double value;
+            std::memcpy(&value, &raw, sizeof(value));
+            return value;
+        }
+
+        /**
+         * @brief Returns the bit pattern of an IEEE 754 single precision float.
+         * @param value The float value.
+         * @return The raw bit pattern.
+         */
+        static inline uint64_t fromFloat(float value) {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        /**
+         * @brief Returns the bit pattern of an IEEE 754 double precision float.
+         * @param value The double value.
+         * @return The raw bit pattern.
+         */
+        static inline uint64_t fromDouble(double value) {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        /**
+         * @brief Extracts a located signal from a frame.
+         * @param data Pointer to the frame, readable for at least max(frameLength, 8) bytes.
+         * @param window The location of the signal.
+         * @return The raw signal value.
+         */
+        static inline uint64_t extract(const uint8_t* data, const Window& window) {
+            uint64_t word = loadLE64(data + window.wordOffset);
+            if (window.motorola) {
+                word = byteSwap64(word);
+            }
+
+            uint64_t spill = (static_cast<uint64_t>(data[window.spillByte]) << window.spillShift) & window.spillMask;
+            return ((word >> window.shift) | spill) & window.mask;
+        }
+
+        /**
+         * @brief Writes a located signal into a frame, leaving all the other bits untouched.
+         * @param data Pointer to the frame, writable for at least max(frameLength, 8) bytes.
+         * @param window The location of the signal.
+         * @param value The raw signal value, bits above the signal length are dropped.
+         */
+        static inline void insert(uint8_t* data, const Window& window, uint64_t value) {
+            uint64_t word = loadLE64(data + window.wordOffset);
+            if (window.motorola) {
+                word = byteSwap64(word);
+            }
+
+            word = (word & ~(window.mask << window.shift)) | ((value & window.mask) << window.shift);
+
+            if (window.motorola) {
+                word = byteSwap64(word);
+            }
+            storeLE64(data + window.wordOffset, word);
+
+            if (window.spillMask) {
+                uint8_t spillBits = static_cast<uint8_t>(window.spillMask >> window.spillShift);
+                data[window.spillByte] = static_cast<uint8_t>((data[window.spillByte] & ~spillBits) | ((value >> window.spillShift) & spillBits));
+            }
+        }
+    };
+}
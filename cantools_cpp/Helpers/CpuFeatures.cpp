@@ -0,0 +1,37 @@
+#include "CpuFeatures.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace cantools_cpp
+{
+
+    const CpuFeatures& CpuFeatures::getInstance() {
+        static CpuFeatures instance;  // Guaranteed to be destroyed, instantiated on first use.
+        return instance;
+    }
+
+    CpuFeatures::CpuFeatures() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+
+        __cpuid(info, 1);
+        _sse41 = (info[2] & (1 << 19)) != 0 && (info[2] & (1 << 9)) != 0;
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+
+        if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(info, 7, 0);
+            _avx2 = (info[1] & (1 << 5)) != 0;
+        }
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_cpu_init();
+        _sse41 = __builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("ssse3");
+        _avx2 = __builtin_cpu_supports("avx2");
+#endif
+    }
+}
@@ -0,0 +1,43 @@
+/**
+ * @file CpuFeatures.hpp
+ * @brief Runtime detection of the SIMD instruction sets used by the batch decoding kernels.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+namespace cantools_cpp
+{
+    class CpuFeatures {
+    public:
+        /**
+         * @brief Singleton instance access method, the CPU is probed on first use.
+         * @return A reference to the single CpuFeatures instance.
+         */
+        static const CpuFeatures& getInstance();
+
+        // Deleted methods to ensure singleton behavior (no copies or assignments)
+        CpuFeatures(const CpuFeatures&) = delete;
+        CpuFeatures& operator=(const CpuFeatures&) = delete;
+
+        /**
+         * @brief Indicates whether SSE4.1 (and SSSE3) instructions are available.
+         * @return true if the SSE4.1 kernels can run.
+         */
+        bool hasSse41() const { return _sse41; }
+
+        /**
+         * @brief Indicates whether AVX2 instructions are available and enabled by the OS.
+         * @return true if the AVX2 kernels can run.
+         */
+        bool hasAvx2() const { return _avx2; }
+
+    private:
+        // Private constructor to ensure singleton
+        CpuFeatures();
+
+        bool _sse41 = false;  ///< SSE4.1 support.
+        bool _avx2 = false;   ///< AVX2 support, including OS support for the YMM state.
+    };
+}
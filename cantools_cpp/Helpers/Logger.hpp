@@ -43,6 +43,16 @@ namespace cantools_cpp {
          */
         void log(const std::string& message, LogLevel level = LOG_DEBUG);
 
+        /**
+         * @brief Indicates whether messages of a log level are printed.
+         *
+         * Lets callers skip building messages that would be dropped, e.g. per line debug messages.
+         *
+         * @param level The severity level.
+         * @return true if messages of this level are printed.
+         */
+        bool isEnabled(LogLevel level) const { return level >= logLevel; }
+
     private:
         Logger() = default;  // Private constructor to prevent instantiation
         Logger(const Logger&) = delete;  // Prevent copying
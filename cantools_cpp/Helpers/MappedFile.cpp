@@ -0,0 +1,142 @@
+/**
+ * @file MappedFile.cpp
+ * @brief Implementation of the MappedFile class, on top of mmap or of Win32 file mappings.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+#include "MappedFile.hpp"
+
+namespace cantools_cpp
+{
+    MappedFile::MappedFile(const std::string& path)
+    {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return;
+        }
+
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size)) {
+            _size = static_cast<size_t>(size.QuadPart);
+            _open = true;
+            if (_size > 0) {
+                HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping) {
+                    _data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                    CloseHandle(mapping);
+                }
+                _open = _data != nullptr;
+            }
+        }
+        CloseHandle(file);
+#else
+        int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0) {
+            return;
+        }
+
+        struct stat status;
+        if (::fstat(file, &status) == 0 && S_ISREG(status.st_mode)) {
+            _size = static_cast<size_t>(status.st_size);
+            _open = true;
+            if (_size > 0) {
+                void* mapping = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, file, 0);
+                _data = mapping != MAP_FAILED ? static_cast<const uint8_t*>(mapping) : nullptr;
+                _open = _data != nullptr;
+            }
+        }
+        ::close(file);
+#endif
+        if (!_open) {
+            _size = 0;
+        }
+    }
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)), _open(std::exchange(other._open, false))
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other) {
+            close();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+            _open = std::exchange(other._open, false);
+        }
+        return *this;
+    }
+
+    void MappedFile::adviseSequential() const
+    {
+#if !defined(_WIN32)
+        if (_data) {
+            ::madvise(const_cast<uint8_t*>(_data), _size, MADV_SEQUENTIAL);
+        }
+#endif
+    }
+
+    void MappedFile::release(size_t offset, size_t length) const
+    {
+        if (!_data || offset >= _size) {
+            return;
+        }
+
+#if defined(_WIN32)
+        SYSTEM_INFO system;
+        GetSystemInfo(&system);
+        size_t pageSize = system.dwPageSize;
+#else
+        size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+#endif
+        // The mapping starts on a page boundary: round the range inwards to whole pages
+        size_t end = std::min(offset + length, _size);
+        size_t first = (offset + pageSize - 1) / pageSize * pageSize;
+        size_t last = end / pageSize * pageSize;
+        if (first >= last) {
+            return;
+        }
+
+#if defined(_WIN32)
+        // Unlocking pages that are not locked removes them from the working set of the process
+        VirtualUnlock(const_cast<uint8_t*>(_data) + first, last - first);
+#else
+        ::madvise(const_cast<uint8_t*>(_data) + first, last - first, MADV_DONTNEED);
+#endif
+    }
+
+    void MappedFile::close()
+    {
+        if (_data) {
+#if defined(_WIN32)
+            UnmapViewOfFile(_data);
+#else
+            ::munmap(const_cast<uint8_t*>(_data), _size);
+#endif
+        }
+        _data = nullptr;
+        _size = 0;
+        _open = false;
+    }
+}
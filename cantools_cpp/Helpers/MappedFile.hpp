@@ -0,0 +1,80 @@
+/**
+ * @file MappedFile.hpp
+ * @brief Declaration of the MappedFile class, a read-only memory mapping of a whole file.
+ *
+ * The pages of the mapping are shared with every other process mapping the same file, and are only
+ * read from disk when touched. The mapping is released when the MappedFile is destroyed. An empty file
+ * opens successfully with no data.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace cantools_cpp
+{
+    class MappedFile {
+    public:
+        MappedFile() = default;
+
+        /**
+         * @brief Maps a file read-only.
+         *
+         * @param path The path of the file; check isOpen() for failures.
+         */
+        explicit MappedFile(const std::string& path);
+
+        /**
+         * @brief Unmaps the file.
+         */
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @brief Indicates whether the file could be opened and mapped.
+         */
+        bool isOpen() const { return _open; }
+
+        /**
+         * @brief Retrieves the content of the file, nullptr for an empty file.
+         */
+        const uint8_t* data() const { return _data; }
+
+        /**
+         * @brief Retrieves the size of the file in bytes.
+         */
+        size_t size() const { return _size; }
+
+        /**
+         * @brief Hints that the file is read once from start to end, so that the system reads ahead.
+         */
+        void adviseSequential() const;
+
+        /**
+         * @brief Drops a range of the file that was read from the memory of the process.
+         *
+         * The pages are read again from the file if touched later, so the data stays valid. Only the whole
+         * pages inside the range are dropped.
+         *
+         * @param offset The start of the range.
+         * @param length The length of the range.
+         */
+        void release(size_t offset, size_t length) const;
+
+    private:
+        void close();
+
+        const uint8_t* _data = nullptr;  ///< First byte of the mapping.
+        size_t _size = 0;                ///< Size of the file.
+        bool _open = false;              ///< Whether the file was mapped.
+    };
+}
@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <vector>
 #include "CANSignal.hpp"
+#include "BitKernel.hpp"
 
 namespace cantools_cpp
 {
@@ -55,45 +56,31 @@ namespace cantools_cpp
          * @return The adjusted start bit for Little Endian interpretation.
          */
         uint16_t getStartBitLE(const CANSignal& signal, int messageByteCount = 8) {
-            uint16_t startByte = static_cast<uint16_t>(signal.getStartBit() / 8);
-
-            uint16_t result = static_cast<uint16_t>(
-                8 * messageByteCount
-                - signal.getLength()
-                - (8 * startByte)
-                - ((8 * (startByte + 1) - signal.getStartBit() - 1) % 8)
-                );
-
-            return result;
+            return static_cast<uint16_t>(BitKernel::motorolaStartBit(signal.getStartBit(), signal.getLength(), messageByteCount));
         }
 
         /**
-         * @brief Extracts bits from a byte array.
+         * @brief Extracts bits from a byte array, read as a little endian bit stream.
+         *
+         * Bits past the end of the array are ignored.
+         *
          * @param data The byte array from which bits are extracted.
          * @param startBit The starting bit position.
          * @param length The number of bits to extract.
          * @return The extracted bits as a 64-bit integer.
          */
         uint64_t extractBits(const std::vector<uint8_t>& data, int startBit, int length) {
-            uint64_t result = 0;
-            int bitIndex = 0;
-
-            for (int bitPos = startBit; bitPos < startBit + length; bitPos++) {
-                int bytePos = bitPos / 8;
-                int bitInByte = bitPos % 8;
-
-                if (bytePos >= data.size())
-                    break;
-
-                bool bit = (data[bytePos] & (1 << bitInByte)) != 0;
-                if (bit) {
-                    result |= 1ULL << bitIndex;
-                }
+            int frameLength = static_cast<int>(data.size());
+            BitKernel::Window window = BitKernel::locate(startBit, length, false, frameLength);
 
-                bitIndex++;
+            if (frameLength >= 8) {
+                return BitKernel::extract(data.data(), window);
             }
 
-            return result;
+            // Short frames are padded to a full word for the kernel
+            uint8_t padded[8] = {};
+            std::copy(data.begin(), data.end(), padded);
+            return BitKernel::extract(padded, window);
         }
 
         /**
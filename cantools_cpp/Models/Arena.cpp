@@ -0,0 +1,78 @@
+/**
+ * @file Arena.cpp
+ * @brief Implementation of the Arena class.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <new>
+#include "Arena.hpp"
+
+namespace cantools_cpp
+{
+    Arena::Arena(size_t blockSize)
+        : _blockSize(blockSize), _current(nullptr), _remaining(0), _allocatedBytes(0), _allocationCount(0)
+    {
+    }
+
+    Arena::~Arena()
+    {
+        for (void* block : _blocks) {
+            ::operator delete(block);
+        }
+    }
+
+    size_t Arena::getAllocatedBytes() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _allocatedBytes;
+    }
+
+    size_t Arena::getAllocationCount() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _allocationCount;
+    }
+
+    void* Arena::do_allocate(size_t bytes, size_t alignment)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _allocatedBytes += bytes;
+        ++_allocationCount;
+
+        // Blocks come from operator new, aligned for any fundamental type; over-aligned requests reserve room to align
+        size_t worstCase = bytes + (alignment > alignof(std::max_align_t) ? alignment : 0);
+        if (worstCase > _blockSize / 4) {
+            // Large allocations get a block of their own, the current block keeps serving the small ones
+            void* block = ::operator new(worstCase);
+            _blocks.push_back(block);
+            void* pointer = block;
+            size_t space = worstCase;
+            return std::align(alignment, bytes, pointer, space);
+        }
+
+        void* pointer = _current;
+        size_t space = _remaining;
+        if (!_current || !std::align(alignment, bytes, pointer, space)) {
+            _current = static_cast<char*>(::operator new(_blockSize));
+            _blocks.push_back(_current);
+            pointer = _current;
+            space = _blockSize;
+            std::align(alignment, bytes, pointer, space);
+        }
+
+        _current = static_cast<char*>(pointer) + bytes;
+        _remaining = space - bytes;
+        return pointer;
+    }
+
+    void Arena::do_deallocate(void*, size_t, size_t)
+    {
+        // Monotonic: the memory is reclaimed all at once when the arena is destroyed
+    }
+
+    bool Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+}
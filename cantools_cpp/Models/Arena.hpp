@@ -0,0 +1,113 @@
+/**
+ * @file Arena.hpp
+ * @brief Declaration of the Arena class, the monotonic memory resource a CAN bus is built in.
+ *
+ * Loading a DBC creates thousands of small, long lived objects (messages, signals, nodes) that are
+ * never freed one by one: they live exactly as long as their bus. Each CANBus owns an Arena and the
+ * parsers create these objects in it through CANBus::create(), which carves them out of a few large
+ * blocks of fixed size instead of one heap allocation each. A new block is started whenever the next
+ * allocation does not fit in the current one, so the tail of every block may be left unused; since
+ * allocations above a quarter of the block size get a block of their own, that tail is always smaller
+ * than a quarter of a block. Deallocation is a no-op; the blocks are released when the arena is
+ * destroyed, i.e. once the bus and every object created in it are gone, since each object keeps the
+ * arena alive through its ArenaAllocator.
+ *
+ * Allocation is serialized by a mutex so that a bus may be filled from several parsing threads.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+namespace cantools_cpp
+{
+    class Arena : public std::pmr::memory_resource {
+    public:
+        static constexpr size_t DefaultBlockSize = 16 * 1024;  ///< Size of the blocks requested from the heap.
+
+        /**
+         * @brief Creates an empty arena; no memory is taken before the first allocation.
+         *
+         * @param blockSize Size in bytes of the blocks requested from the heap; larger allocations get a block of their own.
+         */
+        explicit Arena(size_t blockSize = DefaultBlockSize);
+
+        /**
+         * @brief Releases all the blocks.
+         */
+        ~Arena() override;
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        /**
+         * @brief Retrieves the number of bytes handed out by the arena.
+         *
+         * @return The total size of the allocations, alignment padding excluded.
+         */
+        size_t getAllocatedBytes() const;
+
+        /**
+         * @brief Retrieves the number of allocations served by the arena.
+         *
+         * @return The number of allocations.
+         */
+        size_t getAllocationCount() const;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        mutable std::mutex _mutex;     ///< Protects the blocks and the counters.
+        size_t _blockSize;             ///< Size of the regular blocks.
+        std::vector<void*> _blocks;    ///< Blocks taken from the heap.
+        char* _current;                ///< Next free byte of the last regular block.
+        size_t _remaining;             ///< Free bytes left after _current.
+        size_t _allocatedBytes;        ///< Bytes handed out.
+        size_t _allocationCount;       ///< Allocations served.
+    };
+
+    /**
+     * @brief Allocator placing objects in an Arena and keeping the arena alive.
+     *
+     * Meant for std::allocate_shared: the control block of the object keeps a copy of the allocator, so the
+     * arena outlives every object created in it.
+     */
+    template <typename T>
+    class ArenaAllocator {
+    public:
+        using value_type = T;
+
+        explicit ArenaAllocator(std::shared_ptr<Arena> arena) : _arena(std::move(arena)) {}
+
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) : _arena(other.getArena()) {}
+
+        T* allocate(size_t count) {
+            return static_cast<T*>(_arena->allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* pointer, size_t count) {
+            _arena->deallocate(pointer, count * sizeof(T), alignof(T));
+        }
+
+        const std::shared_ptr<Arena>& getArena() const { return _arena; }
+
+        template <typename U>
+        bool operator==(const ArenaAllocator<U>& other) const { return _arena == other.getArena(); }
+
+        template <typename U>
+        bool operator!=(const ArenaAllocator<U>& other) const { return _arena != other.getArena(); }
+
+    private:
+        std::shared_ptr<Arena> _arena;  ///< Arena the objects are placed in.
+    };
+}
@@ -0,0 +1,151 @@
+/**
+ * @file BatchDecoder.cpp
+ * @brief Implementation of the BatchDecoder class: column dispatch to the SIMD kernels and scalar fallback.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <algorithm>
+#include "BatchDecoder.hpp"
+#include "BatchKernels.hpp"
+#include "CANMessage.hpp"
+#include "CpuFeatures.hpp"
+
+namespace cantools_cpp
+{
+    namespace
+    {
+        /**
+         * @brief Decodes frames [begin, frameCount) of a column one frame at a time.
+         *
+         * Frames from inPlaceCount on are copied to a padded buffer, their words cannot be loaded in place.
+         */
+        template <DbcValueType Type>
+        void decodeScalar(const DecodePlan::Entry& entry, const uint8_t* payloads, size_t begin, size_t inPlaceCount,
+            size_t frameCount, size_t stride, int frameLength, uint64_t* raw, double* physical) {
+            for (size_t i = begin; i < frameCount; ++i) {
+                const uint8_t* frame = payloads + i * stride;
+                uint64_t rawValue;
+
+                if (i < inPlaceCount) {
+                    rawValue = BitKernel::extract(frame, entry.window);
+                }
+                else {
+                    uint8_t padded[8] = {};
+                    std::copy(frame, frame + frameLength, padded);
+                    rawValue = BitKernel::extract(padded, entry.window);
+                }
+
+                if (raw) {
+                    raw[i] = rawValue;
+                }
+                if (physical) {
+                    physical[i] = DecodePlan::toPhysical<Type>(entry, rawValue);
+                }
+            }
+        }
+    }
+
+    BatchDecoder::BatchDecoder(CANMessage& message)
+        : _frameLength(message.getLength()), _simdLevel(getBestSimdLevel())
+    {
+        for (const auto& signal : message.getSignals()) {
+            _entries.push_back(DecodePlan::makeEntry(*signal, _frameLength));
+        }
+    }
+
+    size_t BatchDecoder::getSignalCount() const {
+        return _entries.size();
+    }
+
+    std::string BatchDecoder::getSignalName(size_t column) const {
+        return _entries.at(column).signal->getName();
+    }
+
+    int BatchDecoder::findSignal(const std::string& name) const {
+        for (size_t i = 0; i < _entries.size(); ++i) {
+            if (_entries[i].signal->getName() == name) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    void BatchDecoder::setSimdLevel(SimdLevel level) {
+        _simdLevel = std::min(level, getBestSimdLevel());
+    }
+
+    SimdLevel BatchDecoder::getBestSimdLevel() {
+        const CpuFeatures& cpu = CpuFeatures::getInstance();
+#ifdef CANTOOLS_X86_SIMD
+        if (cpu.hasAvx2()) {
+            return SimdLevel_Avx2;
+        }
+        if (cpu.hasSse41()) {
+            return SimdLevel_Sse41;
+        }
+#endif
+        (void)cpu;
+        return SimdLevel_Scalar;
+    }
+
+    void BatchDecoder::decode(const uint8_t* payloads, size_t frameCount, size_t stride, uint64_t* const* rawColumns, double* const* physicalColumns) const {
+        for (size_t column = 0; column < _entries.size(); ++column) {
+            decodeColumn(_entries[column], payloads, frameCount, stride,
+                rawColumns ? rawColumns[column] : nullptr,
+                physicalColumns ? physicalColumns[column] : nullptr);
+        }
+    }
+
+    void BatchDecoder::decode(const uint8_t* payloads, size_t frameCount, BatchColumns& columns) const {
+        columns.raw.resize(_entries.size());
+        columns.physical.resize(_entries.size());
+
+        std::vector<uint64_t*> rawColumns(_entries.size());
+        std::vector<double*> physicalColumns(_entries.size());
+        for (size_t column = 0; column < _entries.size(); ++column) {
+            columns.raw[column].resize(frameCount);
+            columns.physical[column].resize(frameCount);
+            rawColumns[column] = columns.raw[column].data();
+            physicalColumns[column] = columns.physical[column].data();
+        }
+
+        decode(payloads, frameCount, static_cast<size_t>(_frameLength), rawColumns.data(), physicalColumns.data());
+    }
+
+    void BatchDecoder::decodeColumn(const DecodePlan::Entry& entry, const uint8_t* payloads, size_t frameCount, size_t stride, uint64_t* raw, double* physical) const {
+        const BitKernel::Window& window = entry.window;
+
+        // The batch ends with the last frame: words of short frames near the end cannot be loaded in place
+        size_t batchBytes = frameCount == 0 ? 0 : (frameCount - 1) * stride + _frameLength;
+        size_t wordEnd = window.wordOffset + 8;
+        size_t inPlaceCount = batchBytes < wordEnd ? 0 : std::min(frameCount, (batchBytes - wordEnd) / stride + 1);
+
+        size_t done = 0;
+
+#ifdef CANTOOLS_X86_SIMD
+        // Float and double columns stay scalar, integer columns go through the SIMD kernels when they fit
+        bool integer = entry.valueType == Signed || entry.valueType == Unsigned;
+        if (_simdLevel != SimdLevel_Scalar && integer && window.spillMask == 0 && window.mask < (1ULL << 52)) {
+            BatchColumnJob job{ payloads, inPlaceCount, stride, window.wordOffset, window.mask, entry.signBit, window.shift, window.motorola,
+                entry.factor, entry.offset, raw, physical };
+            done = _simdLevel == SimdLevel_Avx2 ? decodeColumnAvx2(job) : decodeColumnSse41(job);
+        }
+#endif
+
+        switch (entry.valueType) {
+        case Signed:
+            decodeScalar<Signed>(entry, payloads, done, inPlaceCount, frameCount, stride, _frameLength, raw, physical);
+            break;
+        case IEEEFloat:
+            decodeScalar<IEEEFloat>(entry, payloads, done, inPlaceCount, frameCount, stride, _frameLength, raw, physical);
+            break;
+        case IEEEDouble:
+            decodeScalar<IEEEDouble>(entry, payloads, done, inPlaceCount, frameCount, stride, _frameLength, raw, physical);
+            break;
+        default:
+            decodeScalar<Unsigned>(entry, payloads, done, inPlaceCount, frameCount, stride, _frameLength, raw, physical);
+            break;
+        }
+    }
+}
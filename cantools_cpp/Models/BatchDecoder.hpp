@@ -0,0 +1,140 @@
+/**
+ * @file BatchDecoder.hpp
+ * @brief Declaration of the BatchDecoder class for decoding many frames of the same message into columns.
+ *
+ * The BatchDecoder is built from a CANMessage and decodes a contiguous array of payloads into
+ * struct-of-arrays output: one raw and one physical column per signal. Each column is decoded by a
+ * SIMD kernel (AVX2 or SSE4.1, selected at runtime from the CPU features) with a scalar fallback.
+ * Multiplexed signals are decoded for every frame; use the multiplexor column to tell which rows are valid.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "DecodePlan.hpp"
+
+namespace cantools_cpp
+{
+    class CANMessage;
+
+    /**
+     * @enum SimdLevel
+     * @brief Instruction set used by the batch kernels.
+     */
+    enum SimdLevel
+    {
+        SimdLevel_Scalar,  ///< Portable scalar code
+        SimdLevel_Sse41,   ///< SSE4.1, two frames per iteration
+        SimdLevel_Avx2     ///< AVX2, four frames per iteration
+    };
+
+    /**
+     * @struct BatchColumns
+     * @brief Struct-of-arrays output of a batch decode, indexed by signal then by frame.
+     */
+    struct BatchColumns
+    {
+        std::vector<std::vector<uint64_t>> raw;     ///< Raw values, one column per signal.
+        std::vector<std::vector<double>> physical;  ///< Physical values, one column per signal.
+    };
+
+    class BatchDecoder {
+    public:
+        /**
+         * @brief Constructs a batch decoder for the signals of a message.
+         *
+         * The decoder captures the current layout of the message; it must be rebuilt if the message
+         * length or its signals change.
+         *
+         * @param message The message whose frames will be decoded.
+         */
+        explicit BatchDecoder(CANMessage& message);
+
+        /**
+         * @brief Retrieves the number of signals (columns) decoded per frame.
+         *
+         * @return The number of signals.
+         */
+        size_t getSignalCount() const;
+
+        /**
+         * @brief Retrieves the name of the signal decoded into a given column.
+         *
+         * @param column The column index.
+         * @return The name of the signal.
+         */
+        std::string getSignalName(size_t column) const;
+
+        /**
+         * @brief Finds the column of a signal by name.
+         *
+         * @param name The name of the signal.
+         * @return The column index, or -1 if the message has no such signal.
+         */
+        int findSignal(const std::string& name) const;
+
+        /**
+         * @brief Retrieves the frame length the decoder was built for.
+         *
+         * @return The data length of the message in bytes.
+         */
+        int getFrameLength() const { return _frameLength; }
+
+        /**
+         * @brief Retrieves the instruction set used by decode().
+         *
+         * @return The active SIMD level.
+         */
+        SimdLevel getSimdLevel() const { return _simdLevel; }
+
+        /**
+         * @brief Restricts the instruction set used by decode(), e.g. to compare against the scalar path.
+         *
+         * Levels not supported by the CPU fall back to the best supported one below them.
+         *
+         * @param level The requested SIMD level.
+         */
+        void setSimdLevel(SimdLevel level);
+
+        /**
+         * @brief Retrieves the best instruction set supported by the CPU.
+         *
+         * @return The highest SIMD level the kernels can use.
+         */
+        static SimdLevel getBestSimdLevel();
+
+        /**
+         * @brief Decodes frames into caller provided columns.
+         *
+         * @param payloads Pointer to the first frame; frames are stride bytes apart.
+         * @param frameCount Number of frames to decode.
+         * @param stride Distance in bytes between two frames, at least the frame length.
+         * @param rawColumns One output array of frameCount values per signal, or nullptr to skip raw values.
+         * @param physicalColumns One output array of frameCount values per signal, or nullptr to skip physical values.
+         */
+        void decode(const uint8_t* payloads, size_t frameCount, size_t stride, uint64_t* const* rawColumns, double* const* physicalColumns) const;
+
+        /**
+         * @brief Decodes tightly packed frames into columns resized to the frame count.
+         *
+         * @param payloads Pointer to frameCount frames of getFrameLength() bytes each.
+         * @param frameCount Number of frames to decode.
+         * @param columns The output columns.
+         */
+        void decode(const uint8_t* payloads, size_t frameCount, BatchColumns& columns) const;
+
+    private:
+        /**
+         * @brief Decodes one signal column.
+         */
+        void decodeColumn(const DecodePlan::Entry& entry, const uint8_t* payloads, size_t frameCount, size_t stride, uint64_t* raw, double* physical) const;
+
+        std::vector<DecodePlan::Entry> _entries;  ///< Layout of each decoded signal.
+        int _frameLength;                          ///< Data length of the message in bytes.
+        SimdLevel _simdLevel;                      ///< Instruction set used by the kernels.
+    };
+}
@@ -0,0 +1,271 @@
+/**
+ * @file BatchEncoder.cpp
+ * @brief Implementation of the BatchEncoder class: word accumulation, dispatch to the SIMD kernels and scalar fallback.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <algorithm>
+#include <map>
+#include "BatchEncoder.hpp"
+#include "BatchKernels.hpp"
+#include "CANMessage.hpp"
+#include "Logger.hpp"
+
+namespace cantools_cpp
+{
+    BatchEncoder::BatchEncoder(CANMessage& message)
+        : _rawSlots(0), _selectSlots(0), _frameLength(message.getLength()), _simdLevel(BatchDecoder::getBestSimdLevel())
+    {
+        const std::vector<std::shared_ptr<CANSignal>>& signals = message.getSignals();
+
+        // Encode the signals by multiplexing depth, so that each multiplexor is encoded before its signals
+        std::vector<std::pair<size_t, size_t>> depths;
+        for (size_t i = 0; i < signals.size(); ++i) {
+            size_t depth = 0;
+            auto multiplexor = signals[i]->isMultiplexed() ? signals[i]->getMultiplexorSignal() : nullptr;
+            while (multiplexor && depth < signals.size()) {
+                ++depth;
+                multiplexor = multiplexor->isMultiplexed() ? multiplexor->getMultiplexorSignal() : nullptr;
+            }
+            depths.push_back({ depth, i });
+        }
+        std::stable_sort(depths.begin(), depths.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        std::map<const CANSignal*, size_t> positions;
+        _order.resize(signals.size());
+        for (const auto& depth : depths) {
+            CANSignal& signal = *signals[depth.second];
+
+            Column column{};
+            column.entry = DecodePlan::makeEntry(signal, _frameLength);
+            column.input = depth.second;
+            column.multiplexor = NoSlot;
+            column.rawSlot = NoSlot;
+            column.selectSlot = NoSlot;
+
+            auto multiplexor = signal.isMultiplexed() ? signal.getMultiplexorSignal() : nullptr;
+            auto found = multiplexor ? positions.find(multiplexor.get()) : positions.end();
+            if (found != positions.end()) {
+                column.multiplexor = static_cast<int>(found->second);
+                column.selectSlot = _selectSlots++;
+            }
+
+            positions[&signal] = _columns.size();
+            _order[depth.second] = _columns.size();
+            _columns.push_back(column);
+        }
+
+        // Overlapping signals are written in place in declaration order, the last one winning as in
+        // CANMessage::pack, since ORing them into the words would merge their bits
+        std::vector<std::vector<uint8_t>> footprints;
+        for (const Column& column : _columns) {
+            footprints.push_back(std::vector<uint8_t>(static_cast<size_t>(std::max(_frameLength, 8))));
+            BitKernel::insert(footprints.back().data(), column.entry.window, ~0ULL);
+        }
+        auto overlaps = [&footprints](size_t a, size_t b) {
+            for (size_t byte = 0; byte < footprints[a].size(); ++byte) {
+                if (footprints[a][byte] & footprints[b][byte]) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        for (size_t i = 0; i < _columns.size(); ++i) {
+            _columns[i].inPlace = _columns[i].entry.window.spillMask != 0;
+            for (size_t j = 0; j < _columns.size() && !_columns[i].inPlace; ++j) {
+                _columns[i].inPlace = j != i && overlaps(i, j);
+            }
+        }
+
+        for (size_t i = 0; i < _columns.size(); ++i) {
+            Column& column = _columns[i];
+            const BitKernel::Window& window = column.entry.window;
+            if (column.inPlace) {
+                _inPlaceColumns.push_back(i);
+            }
+            else if (window.mask) {
+                auto offset = std::find(_wordOffsets.begin(), _wordOffsets.end(), window.wordOffset);
+                column.word = static_cast<size_t>(offset - _wordOffsets.begin());
+                if (offset == _wordOffsets.end()) {
+                    _wordOffsets.push_back(window.wordOffset);
+                }
+            }
+
+            // The kernels saturate to the window, which must then cover the whole signal
+            const CANSignal& signal = *column.entry.signal;
+            uint64_t signalMask = signal.getLength() >= 64 ? ~0ULL : (1ULL << signal.getLength()) - 1;
+            bool integer = column.entry.valueType == Signed || column.entry.valueType == Unsigned;
+            column.vectorized = integer && !column.inPlace && window.mask != 0 && window.mask == signalMask && window.mask < (1ULL << 52);
+        }
+        std::sort(_inPlaceColumns.begin(), _inPlaceColumns.end(), [this](size_t a, size_t b) { return _columns[a].input < _columns[b].input; });
+
+        // Multiplexors keep their raw values for the presence of their signals, in place signals until they are written
+        for (Column& column : _columns) {
+            if (column.multiplexor != NoSlot && _columns[column.multiplexor].rawSlot == NoSlot) {
+                _columns[column.multiplexor].rawSlot = _rawSlots++;
+            }
+        }
+        for (size_t column : _inPlaceColumns) {
+            if (_columns[column].rawSlot == NoSlot) {
+                _columns[column].rawSlot = _rawSlots++;
+            }
+        }
+    }
+
+    size_t BatchEncoder::getSignalCount() const {
+        return _columns.size();
+    }
+
+    std::string BatchEncoder::getSignalName(size_t column) const {
+        return _columns.at(_order.at(column)).entry.signal->getName();
+    }
+
+    int BatchEncoder::findSignal(const std::string& name) const {
+        for (size_t i = 0; i < _order.size(); ++i) {
+            if (_columns[_order[i]].entry.signal->getName() == name) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    void BatchEncoder::setSimdLevel(SimdLevel level) {
+        _simdLevel = std::min(level, BatchDecoder::getBestSimdLevel());
+    }
+
+    void BatchEncoder::encode(const double* const* physicalColumns, size_t frameCount, uint8_t* payloads, size_t stride) const {
+        std::vector<uint64_t> words(_wordOffsets.size() * ChunkSize);
+        std::vector<uint64_t> raw(static_cast<size_t>(_rawSlots) * ChunkSize);
+        std::vector<uint64_t> select(static_cast<size_t>(_selectSlots) * ChunkSize);
+
+        for (size_t begin = 0; begin < frameCount; begin += ChunkSize) {
+            size_t count = std::min(ChunkSize, frameCount - begin);
+            encodeChunk(physicalColumns, begin, count, frameCount, payloads, stride, words, raw, select);
+        }
+    }
+
+    std::vector<uint8_t> BatchEncoder::encode(const std::vector<std::vector<double>>& physicalColumns) const {
+        if (physicalColumns.size() != _columns.size()) {
+            Logger::getInstance().log("Batch encode expects one column per signal", Logger::LOG_ERROR);
+            return {};
+        }
+
+        size_t frameCount = physicalColumns.empty() ? 0 : physicalColumns[0].size();
+        std::vector<const double*> columns;
+        for (const auto& column : physicalColumns) {
+            if (column.size() != frameCount) {
+                Logger::getInstance().log("Batch encode columns have different sizes", Logger::LOG_ERROR);
+                return {};
+            }
+            columns.push_back(column.data());
+        }
+
+        std::vector<uint8_t> payloads(frameCount * _frameLength);
+        encode(columns.data(), frameCount, payloads.data(), static_cast<size_t>(_frameLength));
+        return payloads;
+    }
+
+    void BatchEncoder::encodeChunk(const double* const* physicalColumns, size_t begin, size_t count, size_t frameCount, uint8_t* payloads, size_t stride,
+        std::vector<uint64_t>& words, std::vector<uint64_t>& raw, std::vector<uint64_t>& select) const {
+        std::fill(words.begin(), words.end(), 0);
+
+        for (const Column& column : _columns) {
+            const DecodePlan::Entry& entry = column.entry;
+            const BitKernel::Window& window = entry.window;
+            const double* physical = physicalColumns[column.input] ? physicalColumns[column.input] + begin : nullptr;
+            uint64_t* rawOut = column.rawSlot != NoSlot ? &raw[column.rawSlot * ChunkSize] : nullptr;
+            uint64_t* selectOut = column.selectSlot != NoSlot ? &select[column.selectSlot * ChunkSize] : nullptr;
+
+            if (selectOut) {
+                // Present where the multiplexor is present and holds one of the multiplexer values of the signal
+                const Column& multiplexor = _columns[column.multiplexor];
+                const uint64_t* multiplexorRaw = &raw[multiplexor.rawSlot * ChunkSize];
+                const uint64_t* multiplexorSelect = multiplexor.selectSlot != NoSlot ? &select[multiplexor.selectSlot * ChunkSize] : nullptr;
+                for (size_t i = 0; i < count; ++i) {
+                    bool present = (!multiplexorSelect || multiplexorSelect[i]) &&
+                        entry.signal->isMultiplexerValue(multiplexorRaw[i] & multiplexor.entry.window.mask);
+                    selectOut[i] = present ? ~0ULL : 0;
+                }
+            }
+
+            if (!physical) {
+                if (rawOut) {
+                    std::fill(rawOut, rawOut + count, 0);
+                }
+                continue;
+            }
+
+            uint64_t* word = window.mask && !column.inPlace ? &words[column.word * ChunkSize] : nullptr;
+            size_t done = 0;
+
+#ifdef CANTOOLS_X86_SIMD
+            if (_simdLevel != SimdLevel_Scalar && column.vectorized) {
+                BatchEncodeJob job{ physical, count, window.mask, entry.signBit, window.shift, window.motorola,
+                    entry.factor, entry.offset, selectOut, word, rawOut };
+                done = _simdLevel == SimdLevel_Avx2 ? encodeColumnAvx2(job) : encodeColumnSse41(job);
+            }
+#endif
+
+            for (size_t i = done; i < count; ++i) {
+                uint64_t rawValue = entry.signal->physicalToRaw(physical[i]);
+                if (rawOut) {
+                    rawOut[i] = rawValue;
+                }
+                if (word) {
+                    uint64_t placed = (rawValue & window.mask) << window.shift;
+                    if (window.motorola) {
+                        placed = BitKernel::byteSwap64(placed);
+                    }
+                    word[i] |= selectOut ? placed & selectOut[i] : placed;
+                }
+            }
+        }
+
+        // The batch ends with the last frame: words of short frames near the end cannot be stored in place
+        size_t batchBytes = (frameCount - 1) * stride + _frameLength;
+
+        for (size_t i = 0; i < count; ++i) {
+            size_t row = begin + i;
+            uint8_t* frame = payloads + row * stride;
+            std::fill(frame, frame + _frameLength, 0);
+
+            for (size_t w = 0; w < _wordOffsets.size(); ++w) {
+                uint64_t value = words[w * ChunkSize + i];
+                if (row * stride + _wordOffsets[w] + 8 <= batchBytes) {
+                    uint8_t* target = frame + _wordOffsets[w];
+                    BitKernel::storeLE64(target, BitKernel::loadLE64(target) | value);
+                }
+                else {
+                    // Only frames shorter than a word get here, their word starts at the first byte
+                    uint8_t padded[8] = {};
+                    std::copy(frame, frame + _frameLength, padded);
+                    BitKernel::storeLE64(padded, BitKernel::loadLE64(padded) | value);
+                    std::copy(padded, padded + _frameLength, frame);
+                }
+            }
+
+            if (_inPlaceColumns.empty()) {
+                continue;
+            }
+
+            // Written in declaration order, over the bits of the overlapped signals; as above, frames shorter
+            // than a word at the end of the batch are padded
+            uint8_t padded[8] = {};
+            bool pad = row * stride + 8 > batchBytes && _frameLength < 8;
+            uint8_t* target = pad ? padded : frame;
+            if (pad) {
+                std::copy(frame, frame + _frameLength, padded);
+            }
+            for (size_t inPlace : _inPlaceColumns) {
+                const Column& column = _columns[inPlace];
+                if (column.selectSlot == NoSlot || select[column.selectSlot * ChunkSize + i]) {
+                    BitKernel::insert(target, column.entry.window, raw[column.rawSlot * ChunkSize + i]);
+                }
+            }
+            if (pad) {
+                std::copy(padded, padded + _frameLength, frame);
+            }
+        }
+    }
+}
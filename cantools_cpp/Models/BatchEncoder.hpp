@@ -0,0 +1,139 @@
+/**
+ * @file BatchEncoder.hpp
+ * @brief Declaration of the BatchEncoder class for encoding columns of physical values into many frames.
+ *
+ * The BatchEncoder is the counterpart of the BatchDecoder: it is built from a CANMessage and encodes
+ * struct-of-arrays input, one physical column per signal, into a contiguous array of payloads. Scaling,
+ * rounding, saturation to the signal length and bit placement of integer signals run in SIMD kernels
+ * (AVX2 or SSE4.1, selected at runtime from the CPU features), which accumulate the frame words before
+ * a single store per word. Float and double signals, and the few signals spilling out of a 64 bit word,
+ * use the scalar conversion of CANSignal::physicalToRaw. Multiplexed signals are only written to the
+ * frames where the multiplexor columns select them. Signals sharing bits with another signal are written
+ * in place in declaration order, so that the last one wins as with CANMessage::pack.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "BatchDecoder.hpp"
+
+namespace cantools_cpp
+{
+    class CANMessage;
+
+    class BatchEncoder {
+    public:
+        /**
+         * @brief Constructs a batch encoder for the signals of a message.
+         *
+         * The encoder captures the current layout and multiplexing of the message; it must be rebuilt
+         * if the message length or its signals change.
+         *
+         * @param message The message whose frames will be encoded.
+         */
+        explicit BatchEncoder(CANMessage& message);
+
+        /**
+         * @brief Retrieves the number of signals (columns) encoded per frame.
+         *
+         * @return The number of signals.
+         */
+        size_t getSignalCount() const;
+
+        /**
+         * @brief Retrieves the name of the signal encoded from a given column.
+         *
+         * @param column The column index.
+         * @return The name of the signal.
+         */
+        std::string getSignalName(size_t column) const;
+
+        /**
+         * @brief Finds the column of a signal by name.
+         *
+         * @param name The name of the signal.
+         * @return The column index, or -1 if the message has no such signal.
+         */
+        int findSignal(const std::string& name) const;
+
+        /**
+         * @brief Retrieves the frame length the encoder was built for.
+         *
+         * @return The data length of the message in bytes.
+         */
+        int getFrameLength() const { return _frameLength; }
+
+        /**
+         * @brief Retrieves the instruction set used by encode().
+         *
+         * @return The active SIMD level.
+         */
+        SimdLevel getSimdLevel() const { return _simdLevel; }
+
+        /**
+         * @brief Restricts the instruction set used by encode(), e.g. to compare against the scalar path.
+         *
+         * Levels not supported by the CPU fall back to the best supported one below them.
+         *
+         * @param level The requested SIMD level.
+         */
+        void setSimdLevel(SimdLevel level);
+
+        /**
+         * @brief Encodes physical columns into caller provided frames.
+         *
+         * The first getFrameLength() bytes of each frame are overwritten, the bytes between frames are left untouched.
+         *
+         * @param physicalColumns One input array of frameCount values per signal; a nullptr column encodes the signal as 0.
+         * @param frameCount Number of frames to encode.
+         * @param payloads Pointer to the first frame; frames are stride bytes apart.
+         * @param stride Distance in bytes between two frames, at least the frame length.
+         */
+        void encode(const double* const* physicalColumns, size_t frameCount, uint8_t* payloads, size_t stride) const;
+
+        /**
+         * @brief Encodes physical columns into tightly packed frames.
+         *
+         * @param physicalColumns One column per signal, all of the same size.
+         * @return The frames, getFrameLength() bytes each; empty if the columns do not match the signals.
+         */
+        std::vector<uint8_t> encode(const std::vector<std::vector<double>>& physicalColumns) const;
+
+    private:
+        static constexpr size_t ChunkSize = 256;  ///< Number of frames whose words are accumulated at once.
+        static constexpr int NoSlot = -1;         ///< Scratch slot of columns that do not need one.
+
+        /**
+         * @brief Layout and encoding strategy of one signal column.
+         */
+        struct Column {
+            DecodePlan::Entry entry;  ///< Layout of the signal in the frame.
+            size_t input;             ///< Index of the physical input column.
+            size_t word;              ///< Index of the accumulated frame word holding the signal.
+            int multiplexor;          ///< Column of the multiplexor the signal depends on, -1 if always present.
+            int rawSlot;              ///< Scratch slot keeping the raw values, for multiplexors and in place signals.
+            int selectSlot;           ///< Scratch slot keeping the per frame presence masks, for multiplexed signals.
+            bool vectorized;          ///< Whether the SIMD kernels can encode the column.
+            bool inPlace;             ///< Whether the signal is written in place rather than ORed into a word.
+        };
+
+        /**
+         * @brief Encodes frames [begin, begin + count) of the batch.
+         */
+        void encodeChunk(const double* const* physicalColumns, size_t begin, size_t count, size_t frameCount, uint8_t* payloads, size_t stride,
+            std::vector<uint64_t>& words, std::vector<uint64_t>& raw, std::vector<uint64_t>& select) const;
+
+        std::vector<Column> _columns;          ///< Columns in encoding order, multiplexors before their signals.
+        std::vector<size_t> _order;            ///< Position in _columns of each input column.
+        std::vector<uint16_t> _wordOffsets;    ///< Byte offset of each accumulated frame word.
+        std::vector<size_t> _inPlaceColumns;   ///< Spilled and overlapping columns, written in place in declaration order once the words are stored.
+        int _rawSlots;                         ///< Number of raw scratch slots.
+        int _selectSlots;                      ///< Number of presence scratch slots.
+        int _frameLength;                      ///< Data length of the message in bytes.
+        SimdLevel _simdLevel;                  ///< Instruction set used by the kernels.
+    };
+}
@@ -0,0 +1,97 @@
+/**
+ * @file BatchKernels.hpp
+ * @brief Internal interface of the SIMD column kernels used by BatchDecoder and BatchEncoder.
+ *
+ * The kernels live in their own translation units, compiled with the matching instruction set
+ * enabled. They must only be called after CpuFeatures reported support for that instruction set,
+ * and they only include intrinsics headers so that no shared inline code gets compiled with it.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define CANTOOLS_X86_SIMD 1
+#endif
+
+namespace cantools_cpp
+{
+    /**
+     * @brief One signal column to decode from an array of frames.
+     *
+     * Every frame must be readable for 8 bytes starting at wordOffset, and the signal must not need
+     * a spill byte. The mask must be below 2^52 so that raw values convert exactly to double.
+     * Signed signals are sign extended through their sign bit: (raw ^ signBit) converts exactly,
+     * and signBit is subtracted afterwards.
+     */
+    struct BatchColumnJob {
+        const uint8_t* payloads;  ///< First frame of the batch.
+        size_t frameCount;        ///< Number of frames to decode.
+        size_t stride;            ///< Distance in bytes between two consecutive frames.
+        size_t wordOffset;        ///< Byte offset of the signal word inside a frame.
+        uint64_t mask;            ///< Mask of the signal bits once shifted down.
+        uint64_t signBit;         ///< Sign bit of signed signals, 0 otherwise.
+        unsigned shift;           ///< Position of the signal LSB inside the word.
+        bool motorola;            ///< Whether the word has to be loaded big endian.
+        double factor;            ///< Scaling factor applied to the raw value.
+        double offset;            ///< Offset applied after scaling.
+        uint64_t* raw;            ///< Output raw column, may be nullptr.
+        double* physical;         ///< Output physical column, may be nullptr.
+    };
+
+    /**
+     * @brief One signal column to encode into the frame words of an array of frames.
+     *
+     * Physical values are scaled, rounded half away from zero and saturated to the signal range the same
+     * way as CANSignal::physicalToRaw, for integer signals whose mask is below 2^52. The placed words
+     * are ORed into words, which holds one 64 bit word per frame, as loaded little endian from wordOffset.
+     */
+    struct BatchEncodeJob {
+        const double* physical;   ///< Input physical column.
+        size_t frameCount;        ///< Number of frames to encode.
+        uint64_t mask;            ///< Mask of the signal bits once shifted down.
+        uint64_t signBit;         ///< Sign bit of signed signals, 0 otherwise.
+        unsigned shift;           ///< Position of the signal LSB inside the word.
+        bool motorola;            ///< Whether the word is stored big endian.
+        double factor;            ///< Scaling factor of the signal.
+        double offset;            ///< Offset of the signal.
+        const uint64_t* select;   ///< Per frame mask ANDed with the placed word (~0 or 0), may be nullptr.
+        uint64_t* words;          ///< Frame words receiving the placed values.
+        uint64_t* raw;            ///< Output raw column, may be nullptr.
+    };
+
+#ifdef CANTOOLS_X86_SIMD
+    /**
+     * @brief Decodes a column two frames at a time with SSE4.1.
+     * @param job The column to decode.
+     * @return The number of frames decoded, the remaining ones are left to the caller.
+     */
+    size_t decodeColumnSse41(const BatchColumnJob& job);
+
+    /**
+     * @brief Decodes a column four frames at a time with AVX2.
+     * @param job The column to decode.
+     * @return The number of frames decoded, the remaining ones are left to the caller.
+     */
+    size_t decodeColumnAvx2(const BatchColumnJob& job);
+
+    /**
+     * @brief Encodes a column two frames at a time with SSE4.1.
+     * @param job The column to encode.
+     * @return The number of frames encoded, the remaining ones are left to the caller.
+     */
+    size_t encodeColumnSse41(const BatchEncodeJob& job);
+
+    /**
+     * @brief Encodes a column four frames at a time with AVX2.
+     * @param job The column to encode.
+     * @return The number of frames encoded, the remaining ones are left to the caller.
+     */
+    size_t encodeColumnAvx2(const BatchEncodeJob& job);
+#endif
+}
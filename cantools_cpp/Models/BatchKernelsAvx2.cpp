@@ -0,0 +1,121 @@
+/**
+ * @file BatchKernelsAvx2.cpp
+ * @brief AVX2 column kernels of the batch decoder and encoder, compiled with AVX2 enabled.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include "BatchKernels.hpp"
+
+#ifdef CANTOOLS_X86_SIMD
+
+#include <immintrin.h>
+
+namespace cantools_cpp
+{
+    namespace
+    {
+        template <bool Motorola>
+        size_t decodeColumn(const BatchColumnJob& job) {
+            const __m256i swap = _mm256_setr_epi8(
+                7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+            const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(job.mask));
+            const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(job.shift));
+            const __m256i magicBits = _mm256_set1_epi64x(0x4330000000000000LL);
+            const __m256i signBit = _mm256_set1_epi64x(static_cast<long long>(job.signBit));
+            const __m256d magic = _mm256_set1_pd(4503599627370496.0 + static_cast<double>(job.signBit));  // 2^52 + signBit
+            const __m256d factor = _mm256_set1_pd(job.factor);
+            const __m256d offset = _mm256_set1_pd(job.offset);
+
+            const long long stride = static_cast<long long>(job.stride);
+            const long long* base = reinterpret_cast<const long long*>(job.payloads + job.wordOffset);
+            __m256i index = _mm256_setr_epi64x(0, stride, 2 * stride, 3 * stride);
+            const __m256i step = _mm256_set1_epi64x(4 * stride);
+
+            size_t count = job.frameCount & ~static_cast<size_t>(3);
+
+            for (size_t i = 0; i < count; i += 4) {
+                __m256i word = _mm256_i64gather_epi64(base, index, 1);
+                index = _mm256_add_epi64(index, step);
+
+                if (Motorola) {
+                    word = _mm256_shuffle_epi8(word, swap);
+                }
+
+                __m256i raw = _mm256_and_si256(_mm256_srl_epi64(word, shift), mask);
+                if (job.raw) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(job.raw + i), raw);
+                }
+
+                if (job.physical) {
+                    // Exact conversion of the sign biased value (below 2^52) to double, the bias is removed with the magic
+                    __m256i biased = _mm256_xor_si256(raw, signBit);
+                    __m256d value = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(biased, magicBits)), magic);
+                    _mm256_storeu_pd(job.physical + i, _mm256_add_pd(_mm256_mul_pd(value, factor), offset));
+                }
+            }
+
+            return count;
+        }
+
+        template <bool Motorola>
+        size_t encodeColumn(const BatchEncodeJob& job) {
+            const __m256i swap = _mm256_setr_epi8(
+                7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+            const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(job.shift));
+            const __m256i magicBits = _mm256_set1_epi64x(0x4330000000000000LL);
+            const __m256i signBit = _mm256_set1_epi64x(static_cast<long long>(job.signBit));
+            const __m256d magic = _mm256_set1_pd(4503599627370496.0 + static_cast<double>(job.signBit));  // 2^52 + signBit
+            const __m256d factor = _mm256_set1_pd(job.factor);
+            const __m256d offset = _mm256_set1_pd(job.offset);
+            const __m256d half = _mm256_set1_pd(0.49999999999999994);  // Largest double below 0.5
+            const __m256d signMask = _mm256_set1_pd(-0.0);
+            const __m256d low = _mm256_set1_pd(-static_cast<double>(job.signBit));
+            const __m256d high = _mm256_set1_pd(static_cast<double>(job.mask - job.signBit));
+
+            size_t count = job.frameCount & ~static_cast<size_t>(3);
+
+            for (size_t i = 0; i < count; i += 4) {
+                __m256d scaled = _mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(job.physical + i), offset), factor);
+
+                // Round half away from zero, NaN becomes 0, then saturate to the signal range
+                __m256d rounded = _mm256_round_pd(_mm256_add_pd(scaled, _mm256_or_pd(_mm256_and_pd(scaled, signMask), half)),
+                    _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                rounded = _mm256_and_pd(rounded, _mm256_cmp_pd(rounded, rounded, _CMP_ORD_Q));
+                rounded = _mm256_min_pd(_mm256_max_pd(rounded, low), high);
+
+                // Exact conversion of the sign biased value (below 2^52) to its bits, then back to two's complement
+                __m256i biased = _mm256_xor_si256(_mm256_castpd_si256(_mm256_add_pd(rounded, magic)), magicBits);
+                __m256i raw = _mm256_xor_si256(biased, signBit);
+                if (job.raw) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(job.raw + i), raw);
+                }
+
+                __m256i placed = _mm256_sll_epi64(raw, shift);
+                if (Motorola) {
+                    placed = _mm256_shuffle_epi8(placed, swap);
+                }
+                if (job.select) {
+                    placed = _mm256_and_si256(placed, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(job.select + i)));
+                }
+
+                __m256i* words = reinterpret_cast<__m256i*>(job.words + i);
+                _mm256_storeu_si256(words, _mm256_or_si256(_mm256_loadu_si256(words), placed));
+            }
+
+            return count;
+        }
+    }
+
+    size_t decodeColumnAvx2(const BatchColumnJob& job) {
+        return job.motorola ? decodeColumn<true>(job) : decodeColumn<false>(job);
+    }
+
+    size_t encodeColumnAvx2(const BatchEncodeJob& job) {
+        return job.motorola ? encodeColumn<true>(job) : encodeColumn<false>(job);
+    }
+}
+
+#endif
@@ -0,0 +1,115 @@
+/**
+ * @file BatchKernelsSse41.cpp
+ * @brief SSE4.1 column kernels of the batch decoder and encoder, compiled with SSE4.1 enabled.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include "BatchKernels.hpp"
+
+#ifdef CANTOOLS_X86_SIMD
+
+#include <immintrin.h>
+
+namespace cantools_cpp
+{
+    namespace
+    {
+        template <bool Motorola>
+        size_t decodeColumn(const BatchColumnJob& job) {
+            const __m128i swap = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+            const __m128i mask = _mm_set1_epi64x(static_cast<long long>(job.mask));
+            const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(job.shift));
+            const __m128i magicBits = _mm_set1_epi64x(0x4330000000000000LL);
+            const __m128i signBit = _mm_set1_epi64x(static_cast<long long>(job.signBit));
+            const __m128d magic = _mm_set1_pd(4503599627370496.0 + static_cast<double>(job.signBit));  // 2^52 + signBit
+            const __m128d factor = _mm_set1_pd(job.factor);
+            const __m128d offset = _mm_set1_pd(job.offset);
+
+            const uint8_t* frame = job.payloads + job.wordOffset;
+            size_t count = job.frameCount & ~static_cast<size_t>(1);
+
+            for (size_t i = 0; i < count; i += 2) {
+                __m128i low = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(frame));
+                __m128i high = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(frame + job.stride));
+                __m128i word = _mm_unpacklo_epi64(low, high);
+                frame += 2 * job.stride;
+
+                if (Motorola) {
+                    word = _mm_shuffle_epi8(word, swap);
+                }
+
+                __m128i raw = _mm_and_si128(_mm_srl_epi64(word, shift), mask);
+                if (job.raw) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(job.raw + i), raw);
+                }
+
+                if (job.physical) {
+                    // Exact conversion of the sign biased value (below 2^52) to double, the bias is removed with the magic
+                    __m128i biased = _mm_xor_si128(raw, signBit);
+                    __m128d value = _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(biased, magicBits)), magic);
+                    _mm_storeu_pd(job.physical + i, _mm_add_pd(_mm_mul_pd(value, factor), offset));
+                }
+            }
+
+            return count;
+        }
+
+        template <bool Motorola>
+        size_t encodeColumn(const BatchEncodeJob& job) {
+            const __m128i swap = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+            const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(job.shift));
+            const __m128i magicBits = _mm_set1_epi64x(0x4330000000000000LL);
+            const __m128i signBit = _mm_set1_epi64x(static_cast<long long>(job.signBit));
+            const __m128d magic = _mm_set1_pd(4503599627370496.0 + static_cast<double>(job.signBit));  // 2^52 + signBit
+            const __m128d factor = _mm_set1_pd(job.factor);
+            const __m128d offset = _mm_set1_pd(job.offset);
+            const __m128d half = _mm_set1_pd(0.49999999999999994);  // Largest double below 0.5
+            const __m128d signMask = _mm_set1_pd(-0.0);
+            const __m128d low = _mm_set1_pd(-static_cast<double>(job.signBit));
+            const __m128d high = _mm_set1_pd(static_cast<double>(job.mask - job.signBit));
+
+            size_t count = job.frameCount & ~static_cast<size_t>(1);
+
+            for (size_t i = 0; i < count; i += 2) {
+                __m128d scaled = _mm_div_pd(_mm_sub_pd(_mm_loadu_pd(job.physical + i), offset), factor);
+
+                // Round half away from zero, NaN becomes 0, then saturate to the signal range
+                __m128d rounded = _mm_round_pd(_mm_add_pd(scaled, _mm_or_pd(_mm_and_pd(scaled, signMask), half)),
+                    _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                rounded = _mm_and_pd(rounded, _mm_cmpord_pd(rounded, rounded));
+                rounded = _mm_min_pd(_mm_max_pd(rounded, low), high);
+
+                // Exact conversion of the sign biased value (below 2^52) to its bits, then back to two's complement
+                __m128i biased = _mm_xor_si128(_mm_castpd_si128(_mm_add_pd(rounded, magic)), magicBits);
+                __m128i raw = _mm_xor_si128(biased, signBit);
+                if (job.raw) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(job.raw + i), raw);
+                }
+
+                __m128i placed = _mm_sll_epi64(raw, shift);
+                if (Motorola) {
+                    placed = _mm_shuffle_epi8(placed, swap);
+                }
+                if (job.select) {
+                    placed = _mm_and_si128(placed, _mm_loadu_si128(reinterpret_cast<const __m128i*>(job.select + i)));
+                }
+
+                __m128i* words = reinterpret_cast<__m128i*>(job.words + i);
+                _mm_storeu_si128(words, _mm_or_si128(_mm_loadu_si128(words), placed));
+            }
+
+            return count;
+        }
+    }
+
+    size_t decodeColumnSse41(const BatchColumnJob& job) {
+        return job.motorola ? decodeColumn<true>(job) : decodeColumn<false>(job);
+    }
+
+    size_t encodeColumnSse41(const BatchEncodeJob& job) {
+        return job.motorola ? encodeColumn<true>(job) : encodeColumn<false>(job);
+    }
+}
+
+#endif
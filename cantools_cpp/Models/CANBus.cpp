@@ -6,6 +6,7 @@
  * @date 10/02/2024
  */
 
+#include <algorithm>
 #include "CANBus.hpp"
 #include "Logger.hpp"
 
@@ -38,11 +39,8 @@ namespace cantools_cpp
 
     void CANBus::addMessage(const std::shared_ptr<CANMessage>& message) {
         // Check if a message with the same ID already exists
-        auto it = std::find_if(_allMessages.begin(), _allMessages.end(),
-            [&message](const std::shared_ptr<CANMessage>& m) {
-                return m->getId() == message->getId();
-            });
-        if (it == _allMessages.end()) { // Message ID not found, add new message
+        if (_messageIndex.find(message->getId()) == MessageIndex::NotFound) { // Message ID not found, add new message
+            _messageIndex.insert(message->getId(), static_cast<uint32_t>(_allMessages.size()));
             _allMessages.push_back(message);
             _currentMessage = message;
             _allSignals[_currentMessage->getId()] = std::vector<std::shared_ptr<CANSignal>>();
@@ -54,32 +52,41 @@ namespace cantools_cpp
         }
     }
 
+    void CANBus::addTransmittedMessage(const std::shared_ptr<CANMessage>& message) {
+        auto node = getNodeByName(message->getTransmitter());
+        if (node) {
+            node->addMessage(message);
+        }
+        else {
+            // Transmitter not declared in BU_ (e.g. Vector__XXX), the message still belongs to the bus
+            addMessage(message);
+        }
+    }
+
     void CANBus::addSignal(const std::shared_ptr<CANSignal>& signal) {
         if (_currentMessage) {
             signal->setParent(_currentMessage);
-            auto it = std::find_if(_allSignals[_currentMessage->getId()].begin(), _allSignals[_currentMessage->getId()].end(), [&signal](const std::shared_ptr<CANSignal>& s) {
-                return signal->getName() == s->getName();
+            auto& signals = _allSignals[_currentMessage->getId()];
+            // Names compared in place in the signal tables, without copies
+            const std::string& name = signal->getSignalTable()->getName(signal->getRow());
+            auto it = std::find_if(signals.begin(), signals.end(), [&name](const std::shared_ptr<CANSignal>& s) {
+                return name == s->getSignalTable()->getName(s->getRow());
                 });
-            if (_allSignals[_currentMessage->getId()].size() == 0 || it == _allSignals[_currentMessage->getId()].end())
+            if (it == signals.end())
             {
-                _allSignals[_currentMessage->getId()].push_back(signal);
+                signals.push_back(signal);
+                signal->moveToTable(_signalTable);
                 signal->addObserver(this);
             }
         }
     }
 
     std::shared_ptr<CANMessage> CANBus::getMessageById(const uint32_t id) const {
-        auto it = std::find_if(_allMessages.begin(), _allMessages.end(),
-            [id](const std::shared_ptr<CANMessage>& message) {
-                return message->getId() == id;
-            });
-
-        if (it != _allMessages.end()) {
-            return (*it);
-        }
-        else {
+        uint32_t position = _messageIndex.find(id);
+        if (position == MessageIndex::NotFound) {
             return nullptr;
         }
+        return _allMessages[position];
     }
 
     void CANBus::addSignalValueType(uint32_t messageId, std::string signalName, DbcValueType type) {
@@ -93,14 +100,30 @@ namespace cantools_cpp
         }
     }
 
-    std::vector<std::shared_ptr<CANMessage>> CANBus::getAllMessages()
+    void CANBus::addSignalMultiplexerValues(uint32_t messageId, const std::string& signalName, const std::string& multiplexorName, const std::vector<MultiplexerRange>& values) {
+        auto it = _allSignals.find(messageId);
+        if (it != _allSignals.end())
+        {
+            auto it2 = std::find_if(it->second.begin(), it->second.end(), [&signalName](const std::shared_ptr<CANSignal>& signal) { return signalName == signal->getName(); });
+            if (it2 != it->second.end()) {
+                (*it2)->setMultiplexerValues(multiplexorName, values);
+                return;
+            }
+        }
+
+        Logger::getInstance().log("SG_MUL_VAL_ refers to unknown signal " + signalName, Logger::LOG_ERROR);
+    }
+
+    const std::vector<std::shared_ptr<CANMessage>>& CANBus::getAllMessages() const
     {
         return _allMessages;
     }
 
     void CANBus::build()
     {
-        for (auto message : _allMessages)
+        _signalTable->shrinkToFit();
+
+        for (const auto& message : _allMessages)
         {
             uint32_t messageId = message->getId();
 
@@ -108,12 +131,96 @@ namespace cantools_cpp
 
             if (it != _allSignals.end())
             {
-                for (auto sinal : it->second)
+                for (const auto& sinal : it->second)
                 {
                     message->addSignal(sinal);
                 }
             }
+
+            message->setDecodeMode(_decodeMode);
+            message->setSelectiveDecoding(_selectiveDecoding);
+            message->buildDecodePlan();
+        }
+    }
+
+    void CANBus::setDecodeMode(DecodeMode mode)
+    {
+        _decodeMode = mode;
+        for (const auto& message : _allMessages)
+        {
+            message->setDecodeMode(mode);
+        }
+    }
+
+    DecodeMode CANBus::getDecodeMode() const
+    {
+        return _decodeMode;
+    }
+
+    void CANBus::setSelectiveDecoding(bool selective)
+    {
+        _selectiveDecoding = selective;
+        for (const auto& message : _allMessages)
+        {
+            message->setSelectiveDecoding(selective);
+        }
+    }
+
+    bool CANBus::isSelectiveDecoding() const
+    {
+        return _selectiveDecoding;
+    }
+
+    bool CANBus::subscribeSignal(uint32_t messageId, const std::string& signalName)
+    {
+        auto message = getMessageById(messageId);
+        if (!message)
+        {
+            Logger::getInstance().log("Cannot subscribe to signal " + signalName + " of unknown message " + std::to_string(messageId), Logger::LOG_ERROR);
+            return false;
+        }
+        return message->subscribeSignal(signalName);
+    }
+
+    bool CANBus::unsubscribeSignal(uint32_t messageId, const std::string& signalName)
+    {
+        auto message = getMessageById(messageId);
+        return message && message->unsubscribeSignal(signalName);
+    }
+
+    uint32_t CANBus::findMessagePosition(uint32_t id) const {
+        uint32_t position = _messageIndex.find(id);
+        return position == MessageIndex::NotFound ? InvalidHandle : position;
+    }
+
+    uint32_t CANBus::findMessagePosition(const std::string& name) const {
+        for (size_t i = 0; i < _allMessages.size(); ++i) {
+            if (_allMessages[i]->getName() == name) {
+                return static_cast<uint32_t>(i);
+            }
+        }
+        return InvalidHandle;
+    }
+
+    bool CANBus::receiveFrame(uint32_t messageId, uint8_t* data, int length)
+    {
+        uint32_t position = _messageIndex.find(messageId);
+        if (position == MessageIndex::NotFound)
+        {
+            return false;
         }
+        return receiveFrame(*_allMessages[position], data, length);
+    }
+
+    bool CANBus::receiveFrame(CANMessage& message, uint8_t* data, int length)
+    {
+        if (!message.isDecoded())
+        {
+            return false;
+        }
+
+        message.setData(data, length);
+        return true;
     }
 
     void CANBus::updateMessage(uint32_t messageId)
@@ -121,9 +228,71 @@ namespace cantools_cpp
         notifyObserverAboutMessage(messageId);
     }
 
-    void CANBus::updateSignal(uint32_t messageId, std::string signalName)
+    void CANBus::updateSignal(uint32_t messageId, const std::string& signalName)
     {
-        notifyObserverAboutSignal(messageId, signalName);
+        uint32_t position = _messageIndex.find(messageId);
+        notifyObserverAboutSignal(messageId, position != MessageIndex::NotFound ? _allMessages[position]->findSignalPosition(signalName) : InvalidHandle, signalName);
+    }
+
+    void CANBus::updateSignal(uint32_t messageId, uint32_t signalPosition, const std::string& signalName)
+    {
+        notifyObserverAboutSignal(messageId, signalPosition, signalName);
+    }
+
+    void CANBus::updateMessageId(uint32_t oldId, uint32_t newId)
+    {
+        // The message that changed its ID: the owner of the old ID, or else one left out of the index by a clash
+        uint32_t position = _messageIndex.find(oldId);
+        bool ownedOldId = position != MessageIndex::NotFound && _allMessages[position]->getId() == newId;
+        if (!ownedOldId)
+        {
+            position = findMessagePosition(newId, _messageIndex.find(newId));
+            if (position == MessageIndex::NotFound)
+            {
+                return;
+            }
+        }
+
+        // The first message holding an ID keeps it; the others are found again once it is released
+        uint32_t owner = _messageIndex.find(newId);
+        if (owner != MessageIndex::NotFound && owner != position)
+        {
+            Logger::getInstance().log("Message ID " + std::to_string(newId) + " is used twice on CAN Bus " + _busName, Logger::LOG_ERROR);
+        }
+        else
+        {
+            _messageIndex.insert(newId, position);
+        }
+
+        if (ownedOldId)
+        {
+            _messageIndex.erase(oldId);
+            uint32_t other = findMessagePosition(oldId, position);
+            if (other != MessageIndex::NotFound)
+            {
+                _messageIndex.insert(oldId, other);
+            }
+
+            // Signals not attached yet follow their message
+            auto signals = _allSignals.find(oldId);
+            if (signals != _allSignals.end() && !_allSignals.count(newId))
+            {
+                _allSignals[newId] = std::move(signals->second);
+                _allSignals.erase(signals);
+            }
+        }
+    }
+
+    uint32_t CANBus::findMessagePosition(uint32_t id, uint32_t excludedPosition) const
+    {
+        for (uint32_t position = 0; position < _allMessages.size(); ++position)
+        {
+            if (position != excludedPosition && _allMessages[position]->getId() == id)
+            {
+                return position;
+            }
+        }
+        return MessageIndex::NotFound;
     }
 
     void CANBus::addObserver(IBusManagerObserver* observer)
@@ -140,15 +309,26 @@ namespace cantools_cpp
     {
         for (auto observer : _observers)
         {
-            observer->updateMessage(getName(), messageId);
+            observer->updateMessage(_busName, messageId);
         }
     }
 
-    void CANBus::notifyObserverAboutSignal(uint32_t messageId, std::string signalName)
+    void CANBus::notifyObserverAboutSignal(uint32_t messageId, uint32_t signalPosition, const std::string& signalName)
     {
+        if (_observers.empty())
+        {
+            return;
+        }
+
+        uint32_t messagePosition = _messageIndex.find(messageId);
+        SignalHandle handle;
+        if (messagePosition != MessageIndex::NotFound)
+        {
+            handle = SignalHandle{ _handle.bus, messagePosition, signalPosition };
+        }
         for (auto observer : _observers)
         {
-            observer->updateSignal(getName(), messageId, signalName);
+            observer->updateSignal(handle, _busName, messageId, signalName);
         }
     }
 
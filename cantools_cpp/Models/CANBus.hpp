@@ -17,6 +17,11 @@
 #include <iostream>
 #include "CANNode.hpp"
 #include "CANMessage.hpp"
+#include "MessageIndex.hpp"
+#include "Arena.hpp"
+#include "Handles.hpp"
+#include "SignalTable.hpp"
+#include "ObjectView.hpp"
 #include "IBusObserver.hpp"
 #include "IBusManagerObserver.hpp"
 
@@ -29,7 +34,7 @@ namespace cantools_cpp {
          *
          * @param name The name of the CAN bus.
          */
-        CANBus(const std::string& name) : _busName(name) {}
+        CANBus(const std::string& name) : _busName(name), _signalTable(std::make_shared<SignalTable>()), _arena(std::make_shared<Arena>()), _decodeMode(DecodeMode_Eager), _selectiveDecoding(false) {}
 
         /**
          * @brief Adds a CANNode to the bus.
@@ -52,15 +57,43 @@ namespace cantools_cpp {
          */
         std::string getName() const;
 
+        /**
+         * @brief Retrieves the handle of the bus in its CANBusManager, carried by the signal notifications.
+         *
+         * @return The handle, invalid if the bus was not created by a CANBusManager.
+         */
+        BusHandle getHandle() const { return _handle; }
+
+        /**
+         * @brief Sets the handle of the bus, done by CANBusManager::createBus().
+         *
+         * @param handle The handle of the bus.
+         */
+        void setHandle(BusHandle handle) { _handle = handle; }
+
         /**
          * @brief Retrieves all connected CAN nodes.
          *
-         * @return A vector of shared pointers to connected CANNode instances.
+         * @return A reference to the vector of shared pointers to connected CANNode instances.
          */
-        std::vector<std::shared_ptr<CANNode>> getNodes() {
+        const std::vector<std::shared_ptr<CANNode>>& getNodes() const {
             return _nodes;
         }
 
+        /**
+         * @brief Retrieves a view over the connected nodes, iterated without copies nor reference counting.
+         *
+         * @return A view yielding CANNode references.
+         */
+        ObjectView<CANNode> getNodeView() { return ObjectView<CANNode>(_nodes); }
+
+        /**
+         * @brief Retrieves a read-only view over the connected nodes.
+         *
+         * @return A view yielding const CANNode references.
+         */
+        ObjectView<const CANNode> getNodeView() const { return ObjectView<const CANNode>(_nodes); }
+
         /**
          * @brief Gets a CANNode by its name.
          *
@@ -76,12 +109,21 @@ namespace cantools_cpp {
          */
         void addMessage(const std::shared_ptr<CANMessage>& message);
 
+        /**
+         * @brief Adds a parsed CANMessage through its transmitter node when the node is on the bus, otherwise directly.
+         *
+         * A node only adds the first of its messages with a given name, see CANNode::addMessage().
+         *
+         * @param message A shared pointer to the CANMessage to be added.
+         */
+        virtual void addTransmittedMessage(const std::shared_ptr<CANMessage>& message);
+
         /**
          * @brief Adds a CANSignal to the current message on the bus.
          *
          * @param signal A shared pointer to the CANSignal to be added.
          */
-        void addSignal(const std::shared_ptr<CANSignal>& signal);
+        virtual void addSignal(const std::shared_ptr<CANSignal>& signal);
 
         /**
          * @brief Adds a signal value type for a specific message ID.
@@ -93,29 +135,185 @@ namespace cantools_cpp {
         void addSignalValueType(uint32_t messageId, std::string signalName, DbcValueType type);
 
         /**
-         * @brief Retrieves a CANMessage by its ID.
+         * @brief Sets the extended multiplexing (SG_MUL_VAL_) of a signal for a specific message ID.
+         *
+         * @param messageId The ID of the message.
+         * @param signalName The name of the multiplexed signal.
+         * @param multiplexorName The name of the multiplexor the signal depends on.
+         * @param values The multiplexor values for which the signal is present.
+         */
+        void addSignalMultiplexerValues(uint32_t messageId, const std::string& signalName, const std::string& multiplexorName, const std::vector<MultiplexerRange>& values);
+
+        /**
+         * @brief Retrieves a CANMessage by its ID, in constant time.
          *
          * @param id The ID of the CANMessage to retrieve.
          * @return A shared pointer to the CANMessage if found; otherwise, nullptr.
          */
         std::shared_ptr<CANMessage> getMessageById(const uint32_t id) const;
 
+        /**
+         * @brief Finds the position of a message on the bus from its ID, used as its handle.
+         *
+         * @param id The ID of the message.
+         * @return The position of the message, or InvalidHandle if not found.
+         */
+        uint32_t findMessagePosition(uint32_t id) const;
+
+        /**
+         * @brief Finds the position of a message on the bus from its name, used as its handle.
+         *
+         * @param name The name of the message.
+         * @return The position of the message, or InvalidHandle if not found.
+         */
+        uint32_t findMessagePosition(const std::string& name) const;
+
+        /**
+         * @brief Retrieves a message from its position on the bus.
+         *
+         * @param position The position of the message.
+         * @return The message, or nullptr if the position is out of range.
+         */
+        CANMessage* getMessageAt(uint32_t position) const {
+            return position < _allMessages.size() ? _allMessages[position].get() : nullptr;
+        }
+
         /**
          * @brief Retrieves all messages on the bus.
          *
-         * @return A vector of shared pointers to all CANMessage instances.
+         * @return A reference to the vector of shared pointers to all CANMessage instances.
+         */
+        const std::vector<std::shared_ptr<CANMessage>>& getAllMessages() const;
+
+        /**
+         * @brief Retrieves a view over the messages, iterated without copies nor reference counting.
+         *
+         * @return A view yielding CANMessage references, in the order they were added.
+         */
+        ObjectView<CANMessage> getMessageView() { return ObjectView<CANMessage>(_allMessages); }
+
+        /**
+         * @brief Retrieves a read-only view over the messages.
+         *
+         * @return A view yielding const CANMessage references, in the order they were added.
+         */
+        ObjectView<const CANMessage> getMessageView() const { return ObjectView<const CANMessage>(_allMessages); }
+
+        /**
+         * @brief Retrieves the table storing the fields of the signals of the bus.
+         *
+         * Parsers create the signals directly in it; signals created elsewhere are moved to it by addSignal().
+         *
+         * @return The signal table of the bus.
+         */
+        const std::shared_ptr<SignalTable>& getSignalTable() const { return _signalTable; }
+
+        /**
+         * @brief Retrieves the arena the messages, signals and nodes of the bus are allocated in.
+         *
+         * @return The arena of the bus.
+         */
+        const std::shared_ptr<Arena>& getArena() const { return _arena; }
+
+        /**
+         * @brief Creates an object of the bus (message, signal, node) in the arena of the bus.
+         *
+         * The object is not added to the bus. Its memory is only returned when the arena is released.
+         *
+         * @param args Arguments forwarded to the constructor of the object.
+         * @return A shared pointer to the new object, which keeps the arena alive.
          */
-        std::vector<std::shared_ptr<CANMessage>> getAllMessages();
+        template <typename T, typename... Args>
+        std::shared_ptr<T> create(Args&&... args) const {
+            return std::allocate_shared<T>(ArenaAllocator<T>(_arena), std::forward<Args>(args)...);
+        }
 
         /**
          * @brief Builds the CAN bus with its components.
+         *
+         * Attaches the collected signals to their messages and compiles each message's decode plan.
          */
         void build();
 
+        /**
+         * @brief Sets when the signals of every message on the bus are decoded from the data.
+         *
+         * @param mode The decode mode, also applied to the messages built later.
+         */
+        void setDecodeMode(DecodeMode mode);
+
+        /**
+         * @brief Retrieves when the signals of the messages on the bus are decoded from the data.
+         *
+         * @return The decode mode.
+         */
+        DecodeMode getDecodeMode() const;
+
+        /**
+         * @brief Restricts decoding on the bus to the subscribed signals.
+         *
+         * Frames of messages without any subscribed signal are skipped by receiveFrame, and only the
+         * subscribed signals (plus the multiplexors they depend on) of the other messages are decoded.
+         *
+         * @param selective true to decode only the subscribed signals, also applied to the messages built later.
+         */
+        void setSelectiveDecoding(bool selective);
+
+        /**
+         * @brief Indicates whether only the subscribed signals are decoded.
+         *
+         * @return true if selective decoding is enabled.
+         */
+        bool isSelectiveDecoding() const;
+
+        /**
+         * @brief Subscribes to a signal, so that it is decoded when selective decoding is enabled.
+         *
+         * Subscriptions are counted, each one is withdrawn by a call to unsubscribeSignal().
+         *
+         * @param messageId The ID of the message.
+         * @param signalName The name of the signal.
+         * @return true if the signal exists.
+         */
+        bool subscribeSignal(uint32_t messageId, const std::string& signalName);
+
+        /**
+         * @brief Withdraws a subscription made with subscribeSignal().
+         *
+         * @param messageId The ID of the message.
+         * @param signalName The name of the signal.
+         * @return true if the signal exists.
+         */
+        bool unsubscribeSignal(uint32_t messageId, const std::string& signalName);
+
+        /**
+         * @brief Delivers a received frame to its message.
+         *
+         * @param messageId The ID of the received message.
+         * @param data Pointer to the frame payload.
+         * @param length Length of the payload.
+         * @return true if the frame was decoded, false if the message is unknown or nobody subscribed to it.
+         */
+        bool receiveFrame(uint32_t messageId, uint8_t* data, int length);
+
+        /**
+         * @brief Delivers a received frame to a message of the bus.
+         *
+         * @param message The received message.
+         * @param data Pointer to the frame payload.
+         * @param length Length of the payload.
+         * @return true if the frame was decoded, false if nobody subscribed to the message.
+         */
+        bool receiveFrame(CANMessage& message, uint8_t* data, int length);
+
         // IBusObserver interface methods
         virtual void updateMessage(uint32_t messageId) override;
 
-        virtual void updateSignal(uint32_t messageId, std::string signalName) override;
+        virtual void updateSignal(uint32_t messageId, const std::string& signalName) override;
+
+        virtual void updateSignal(uint32_t messageId, uint32_t signalPosition, const std::string& signalName) override;
+
+        virtual void updateMessageId(uint32_t oldId, uint32_t newId) override;
 
         /**
          * @brief Adds an observer to the bus manager.
@@ -143,17 +341,33 @@ namespace cantools_cpp {
          * @brief Notifies observers about a signal update.
          *
          * @param messageId The ID of the message containing the updated signal.
+         * @param signalPosition The position of the signal in the message.
          * @param signalName The name of the updated signal.
          */
-        void notifyObserverAboutSignal(uint32_t messageId, std::string signalName);
+        void notifyObserverAboutSignal(uint32_t messageId, uint32_t signalPosition, const std::string& signalName);
+
+        /**
+         * @brief Finds a message by ID in the message list, for the IDs held by several messages after setId.
+         *
+         * @param id The message ID.
+         * @param excludedPosition A position to skip, e.g. the message already indexed for the ID.
+         * @return The position of the first other message with this ID, MessageIndex::NotFound if there is none.
+         */
+        uint32_t findMessagePosition(uint32_t id, uint32_t excludedPosition) const;
 
         std::vector<IBusManagerObserver*> _observers;  ///< List of observers for bus manager
         std::string _busName;                           ///< Name of the CAN bus
+        BusHandle _handle;                              ///< Handle of the bus in its CANBusManager
         std::vector<std::shared_ptr<CANNode>> _nodes; ///< Connected nodes
         std::vector<std::shared_ptr<CANMessage>> _allMessages; ///< All messages on the bus
+        MessageIndex _messageIndex;                      ///< Position of each message in _allMessages by ID
         std::map<uint32_t, std::vector<std::shared_ptr<CANSignal>>> _allSignals; ///< Signals by message ID
+        std::shared_ptr<SignalTable> _signalTable;       ///< Fields of the signals of the bus, one row per signal
+        std::shared_ptr<Arena> _arena;                   ///< Memory of the messages, signals and nodes created for the bus
 
         std::shared_ptr<CANMessage> _currentMessage;   ///< Current message being processed
+        DecodeMode _decodeMode;                         ///< Decode mode of the messages on the bus
+        bool _selectiveDecoding;                        ///< Whether the messages only decode their subscribed signals
     };
 
 } // namespace cantools_cpp
@@ -14,7 +14,10 @@
 namespace cantools_cpp
 {
 
-    CANBusManager::CANBusManager() {
+    CANBusManager::CANBusManager() : _stringPool(std::make_shared<StringPool>()) {
+    }
+
+    CANBusManager::CANBusManager(std::shared_ptr<StringPool> stringPool) : _stringPool(std::move(stringPool)) {
     }
 
     CANBusManager::~CANBusManager() {}
@@ -23,6 +26,8 @@ namespace cantools_cpp
         bool ret = true;
         if (_busMap.find(busName) == _busMap.end()) {
             _busMap[busName] = std::make_shared<CANBus>(busName);
+            _busMap[busName]->setHandle(BusHandle{ static_cast<uint32_t>(_buses.size()) });
+            _buses.push_back(_busMap[busName]);
             Logger::getInstance().log("CAN Bus " + busName + " created.", Logger::LOG_INFO);
         }
         else {
@@ -41,4 +46,99 @@ namespace cantools_cpp
             return nullptr;
         }
     }
-}
\ No newline at end of file
+
+    BusHandle CANBusManager::resolveBus(const std::string& busName) const {
+        BusHandle handle;
+        for (size_t i = 0; i < _buses.size(); ++i) {
+            if (_buses[i]->getName() == busName) {
+                handle.bus = static_cast<uint32_t>(i);
+                break;
+            }
+        }
+        return handle;
+    }
+
+    MessageHandle CANBusManager::resolveMessage(BusHandle bus, uint32_t messageId) const {
+        MessageHandle handle;
+        if (CANBus* canBus = getBus(bus)) {
+            handle.bus = bus.bus;
+            handle.message = canBus->findMessagePosition(messageId);
+        }
+        return handle;
+    }
+
+    MessageHandle CANBusManager::resolveMessage(BusHandle bus, const std::string& messageName) const {
+        MessageHandle handle;
+        if (CANBus* canBus = getBus(bus)) {
+            handle.bus = bus.bus;
+            handle.message = canBus->findMessagePosition(messageName);
+        }
+        return handle;
+    }
+
+    SignalHandle CANBusManager::resolveSignal(MessageHandle message, const std::string& signalName) const {
+        SignalHandle handle;
+        if (CANMessage* canMessage = getMessage(message)) {
+            handle.bus = message.bus;
+            handle.message = message.message;
+            handle.signal = canMessage->findSignalPosition(signalName);
+        }
+        return handle;
+    }
+
+    CANBus* CANBusManager::getBus(BusHandle bus) const {
+        return bus.bus < _buses.size() ? _buses[bus.bus].get() : nullptr;
+    }
+
+    CANMessage* CANBusManager::getMessage(MessageHandle message) const {
+        CANBus* canBus = getBus(BusHandle{ message.bus });
+        return canBus ? canBus->getMessageAt(message.message) : nullptr;
+    }
+
+    CANSignal* CANBusManager::getSignal(SignalHandle signal) const {
+        CANMessage* canMessage = getMessage(MessageHandle{ signal.bus, signal.message });
+        return canMessage ? canMessage->getSignalAt(signal.signal) : nullptr;
+    }
+
+    uint64_t CANBusManager::getRawValue(SignalHandle signal) const {
+        return getSignal(signal)->getRawValue();
+    }
+
+    double CANBusManager::getPhysicalValue(SignalHandle signal) const {
+        return getSignal(signal)->getPhysicalValue();
+    }
+
+    void CANBusManager::setRawValue(SignalHandle signal, uint64_t value) {
+        getSignal(signal)->setRawValue(value);
+    }
+
+    void CANBusManager::setPhysicalValue(SignalHandle signal, double value) {
+        getSignal(signal)->setPhysicalValue(value);
+    }
+
+    bool CANBusManager::subscribe(SignalHandle signal) {
+        CANMessage* canMessage = getMessage(MessageHandle{ signal.bus, signal.message });
+        CANSignal* canSignal = canMessage ? canMessage->getSignalAt(signal.signal) : nullptr;
+        if (!canSignal) {
+            return false;
+        }
+        canMessage->subscribeSignal(*canSignal);
+        return true;
+    }
+
+    bool CANBusManager::unsubscribe(SignalHandle signal) {
+        CANMessage* canMessage = getMessage(MessageHandle{ signal.bus, signal.message });
+        CANSignal* canSignal = canMessage ? canMessage->getSignalAt(signal.signal) : nullptr;
+        if (!canSignal) {
+            return false;
+        }
+        canMessage->unsubscribeSignal(*canSignal);
+        return true;
+    }
+
+    bool CANBusManager::receiveFrame(MessageHandle message, uint8_t* data, int length) {
+        CANBus* canBus = getBus(BusHandle{ message.bus });
+        CANMessage* canMessage = canBus ? canBus->getMessageAt(message.message) : nullptr;
+        return canMessage && canBus->receiveFrame(*canMessage, data, length);
+    }
+}
@@ -11,16 +11,23 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <vector>
+#include "Handles.hpp"
+#include "StringPool.hpp"
+#include "ObjectView.hpp"
 
 namespace cantools_cpp
 {
     class CANBus;
     class CANMessage;
     class CANNode;
+    class CANSignal;
 
     class CANBusManager {
     private:
         std::unordered_map<std::string, std::shared_ptr<CANBus>> _busMap; ///< Map of CANBus instances indexed by their names.
+        std::vector<std::shared_ptr<CANBus>> _buses; ///< CANBus instances in creation order, indexed by BusHandle.
+        std::shared_ptr<StringPool> _stringPool; ///< Pool interning the metadata strings of the signals and messages of all buses.
 
     public:
         /**
@@ -28,6 +35,13 @@ namespace cantools_cpp
          */
         CANBusManager();
 
+        /**
+         * @brief Constructor for a CANBusManager sharing the string pool of another one.
+         *
+         * @param stringPool The pool interning the metadata strings of the buses of the manager.
+         */
+        explicit CANBusManager(std::shared_ptr<StringPool> stringPool);
+
         /**
          * @brief Destructor for CANBusManager.
          */
@@ -56,11 +70,153 @@ namespace cantools_cpp
         /**
          * @brief Retrieves all managed CAN buses.
          *
-         * @return An unordered map containing all CANBus instances managed by this manager.
+         * @return A reference to the unordered map containing all CANBus instances managed by this manager.
          */
-        virtual std::unordered_map<std::string, std::shared_ptr<CANBus>> getBuses()
+        virtual const std::unordered_map<std::string, std::shared_ptr<CANBus>>& getBuses() const
         {
             return _busMap;
         }
+
+        /**
+         * @brief Retrieves a view over the buses, iterated without copies nor reference counting.
+         *
+         * @return A view yielding CANBus references, in creation order (the order of BusHandle).
+         */
+        ObjectView<CANBus> getBusView() { return ObjectView<CANBus>(_buses); }
+
+        /**
+         * @brief Retrieves a read-only view over the buses.
+         *
+         * @return A view yielding const CANBus references, in creation order.
+         */
+        ObjectView<const CANBus> getBusView() const { return ObjectView<const CANBus>(_buses); }
+
+        /**
+         * @brief Resolves the handle of a bus from its name.
+         *
+         * @param busName The name of the CAN bus.
+         * @return The handle of the bus, invalid if there is no such bus.
+         */
+        BusHandle resolveBus(const std::string& busName) const;
+
+        /**
+         * @brief Retrieves the pool interning the metadata strings of the signals and messages of the buses.
+         *
+         * Parsers pass it to the signals and messages they create.
+         *
+         * @return The string pool of the manager.
+         */
+        std::shared_ptr<StringPool> getStringPool() const {
+            return _stringPool;
+        }
+
+        /**
+         * @brief Resolves the handle of a message from its ID.
+         *
+         * @param bus The handle of the bus holding the message.
+         * @param messageId The ID of the message.
+         * @return The handle of the message, invalid if there is no such message.
+         */
+        MessageHandle resolveMessage(BusHandle bus, uint32_t messageId) const;
+
+        /**
+         * @brief Resolves the handle of a message from its name.
+         *
+         * @param bus The handle of the bus holding the message.
+         * @param messageName The name of the message.
+         * @return The handle of the message, invalid if there is no such message.
+         */
+        MessageHandle resolveMessage(BusHandle bus, const std::string& messageName) const;
+
+        /**
+         * @brief Resolves the handle of a signal from its name, once its bus has been built.
+         *
+         * @param message The handle of the message holding the signal.
+         * @param signalName The name of the signal.
+         * @return The handle of the signal, invalid if there is no such signal.
+         */
+        SignalHandle resolveSignal(MessageHandle message, const std::string& signalName) const;
+
+        /**
+         * @brief Retrieves a bus from its handle.
+         *
+         * @param bus The handle of the bus.
+         * @return The bus, or nullptr if the handle is invalid.
+         */
+        CANBus* getBus(BusHandle bus) const;
+
+        /**
+         * @brief Retrieves a message from its handle.
+         *
+         * @param message The handle of the message.
+         * @return The message, or nullptr if the handle is invalid.
+         */
+        CANMessage* getMessage(MessageHandle message) const;
+
+        /**
+         * @brief Retrieves a signal from its handle.
+         *
+         * @param signal The handle of the signal.
+         * @return The signal, or nullptr if the handle is invalid.
+         */
+        CANSignal* getSignal(SignalHandle signal) const;
+
+        /**
+         * @brief Reads the raw value of a signal.
+         *
+         * @param signal The handle of the signal, which must be valid.
+         * @return The raw value.
+         */
+        uint64_t getRawValue(SignalHandle signal) const;
+
+        /**
+         * @brief Reads the physical value of a signal.
+         *
+         * @param signal The handle of the signal, which must be valid.
+         * @return The physical value.
+         */
+        double getPhysicalValue(SignalHandle signal) const;
+
+        /**
+         * @brief Writes the raw value of a signal into its message.
+         *
+         * @param signal The handle of the signal, which must be valid.
+         * @param value The raw value.
+         */
+        void setRawValue(SignalHandle signal, uint64_t value);
+
+        /**
+         * @brief Writes the physical value of a signal into its message.
+         *
+         * @param signal The handle of the signal, which must be valid.
+         * @param value The physical value.
+         */
+        void setPhysicalValue(SignalHandle signal, double value);
+
+        /**
+         * @brief Subscribes to a signal, so that it is decoded when selective decoding is enabled.
+         *
+         * @param signal The handle of the signal.
+         * @return true if the handle is valid.
+         */
+        bool subscribe(SignalHandle signal);
+
+        /**
+         * @brief Withdraws a subscription made with subscribe().
+         *
+         * @param signal The handle of the signal.
+         * @return true if the handle is valid.
+         */
+        bool unsubscribe(SignalHandle signal);
+
+        /**
+         * @brief Delivers a received frame to a message.
+         *
+         * @param message The handle of the message.
+         * @param data Pointer to the frame payload.
+         * @param length Length of the payload.
+         * @return true if the frame was decoded, false if the handle is invalid or nobody subscribed to the message.
+         */
+        bool receiveFrame(MessageHandle message, uint8_t* data, int length);
     };
 } // namespace cantools_cpp
@@ -12,6 +12,8 @@
  * @date 10/02/2024
  */
 
+#include <algorithm>
+#include <set>
 #include "CANMessage.hpp"
 #include "Logger.hpp"
 
@@ -46,8 +48,24 @@ namespace cantools_cpp {
      * @brief Constructor for the CANMessage class, initializes the message ID and cycle.
      *
      * @param id The ID of the CAN message.
+     * @param stringPool The pool interning the transmitter names, the shared pool if nullptr.
+     * @param memory The resource allocating the observer list, usually the arena of the bus, the heap if nullptr.
      */
-    CANMessage::CANMessage(uint32_t id) : _id(id), _cycle(0) {}
+    CANMessage::CANMessage(uint32_t id, std::shared_ptr<StringPool> stringPool, std::pmr::memory_resource* memory) : _id(id), _dlc(0), _length(0),
+        _stringPool(stringPool ? std::move(stringPool) : StringPool::getShared()), _transmitter(&_stringPool->intern(std::string())), _cycle(0), _decodeMode(DecodeMode_Eager), _dataEpoch(0), _signalsMatchData(true), _selectiveDecoding(false),
+        _updateDepth(0), _updatePending(false), _repackPending(false), _observers(memory ? memory : std::pmr::get_default_resource()) {}
+
+    /**
+     * @brief Destructor, detaches the signals that still point to the message.
+     *
+     * Signals keep a plain pointer to their parent for the frame paths; a signal kept alive by its
+     * user past the message must not follow it.
+     */
+    CANMessage::~CANMessage() {
+        for (const auto& signal : _signals) {
+            signal->releaseParent(this);
+        }
+    }
 
     /**
      * @brief Adds a signal to the CAN message.
@@ -55,6 +73,7 @@ namespace cantools_cpp {
      * @param signal A shared pointer to the CANSignal to be added.
      */
     void CANMessage::addSignal(const std::shared_ptr<CANSignal>& signal) {
+        signal->setPosition(static_cast<uint32_t>(_signals.size()));
         _signals.push_back(signal);
     }
 
@@ -101,8 +120,8 @@ namespace cantools_cpp {
      *
      * @return The transmitter of the CAN message.
      */
-    std::string CANMessage::getTransmitter() const {
-        return _transmitter;
+    const std::string& CANMessage::getTransmitter() const {
+        return *_transmitter;
     }
 
     /**
@@ -129,7 +148,15 @@ namespace cantools_cpp {
      * @param id The new ID of the CAN message.
      */
     void CANMessage::setId(uint32_t id) {
+        uint32_t oldId = _id;
         _id = id;
+
+        // Let the bus move the message in its ID index
+        if (oldId != id) {
+            for (auto observer : _observers) {
+                observer->updateMessageId(oldId, id);
+            }
+        }
     }
 
     /**
@@ -147,7 +174,7 @@ namespace cantools_cpp {
      * @param transmitter The new transmitter of the CAN message.
      */
     void CANMessage::setTransmitter(const std::string& transmitter) {
-        _transmitter = transmitter;
+        _transmitter = &_stringPool->intern(transmitter);
     }
 
     /**
@@ -157,7 +184,8 @@ namespace cantools_cpp {
      */
     void CANMessage::setDlc(int dlc) {
         _dlc = dlc;
-        _data = std::shared_ptr<uint8_t[]>(new uint8_t[_dlc2datalength[dlc]]());
+        _length = _dlc2datalength[dlc];
+        allocateData(_length);
     }
 
     /**
@@ -169,7 +197,22 @@ namespace cantools_cpp {
     {
         _dlc = _datalength2dlc.at(length);
         _length = length;
-        _data = std::shared_ptr<uint8_t[]>(new uint8_t[length]());
+        allocateData(_length);
+    }
+
+    /**
+     * @brief Allocates a zeroed data buffer for the given length and refreshes the decode plan.
+     *
+     * @param length The data length of the CAN message.
+     */
+    void CANMessage::allocateData(int length)
+    {
+        _data = std::shared_ptr<uint8_t[]>(new uint8_t[std::max(length, 8)]());
+        _signalsMatchData = false;
+
+        if (_decodePlan.isBuilt()) {
+            buildDecodePlan();
+        }
     }
 
     /**
@@ -178,7 +221,11 @@ namespace cantools_cpp {
      * @return A vector of additional transmitters.
      */
     std::vector<std::string> CANMessage::getAdditionalTransmitters() const {
-        return _additionalTransmitters;
+        std::vector<std::string> transmitters;
+        for (const std::string* transmitter : _additionalTransmitters) {
+            transmitters.push_back(*transmitter);
+        }
+        return transmitters;
     }
 
     /**
@@ -187,7 +234,10 @@ namespace cantools_cpp {
      * @param addTransmitters A vector of additional transmitters to set.
      */
     void CANMessage::setAdditionalTransmitters(std::vector<std::string> addTransmitters) {
-        _additionalTransmitters = addTransmitters;
+        _additionalTransmitters.clear();
+        for (const std::string& transmitter : addTransmitters) {
+            _additionalTransmitters.push_back(&_stringPool->intern(transmitter));
+        }
     }
 
     /**
@@ -211,9 +261,9 @@ namespace cantools_cpp {
     /**
      * @brief Retrieves the signals associated with the CAN message.
      *
-     * @return A vector of shared pointers to CANSignal objects.
+     * @return A reference to the vector of shared pointers to CANSignal objects.
      */
-    std::vector<std::shared_ptr<CANSignal>> CANMessage::getSignals() {
+    const std::vector<std::shared_ptr<CANSignal>>& CANMessage::getSignals() const {
         return _signals;
     }
 
@@ -246,6 +296,21 @@ namespace cantools_cpp {
         return ptr;
     }
 
+    /**
+     * @brief Finds the position of a signal in the message from its name, used as its handle.
+     *
+     * @param name The name of the signal.
+     * @return The position of the signal, or InvalidHandle if not found.
+     */
+    uint32_t CANMessage::findSignalPosition(const std::string& name) const {
+        for (size_t i = 0; i < _signals.size(); ++i) {
+            if (_signals[i]->getName() == name) {
+                return static_cast<uint32_t>(i);
+            }
+        }
+        return InvalidHandle;
+    }
+
     /**
      * @brief Sets the data of the CAN message and decodes signals from the data.
      *
@@ -253,15 +318,278 @@ namespace cantools_cpp {
      * @param length Length of the data.
      */
     void CANMessage::setData(uint8_t* data, int length) {
-        if (length > sizeof(_data)) {
+        if (length > _length) {
             Logger::getInstance().log("setData has invalid length", Logger::LOG_INFO);
+            length = _length;
+        }
+        if (!_decodePlan.isBuilt()) {
+            buildDecodePlan();
+        }
+        if (!isDecoded()) {
+            std::copy(data, data + length, _data.get());
+            return;
+        }
+
+        if (_decodeMode == DecodeMode_OnChange && _signalsMatchData) {
+            // XOR against the previous payload, bytes that are not written do not change
+            uint8_t diff[64] = {};
+            uint8_t changed = 0;
+            for (int i = 0; i < length; ++i) {
+                diff[i] = data[i] ^ _data[i];
+                changed |= diff[i];
+            }
+            if (changed == 0) {
+                return;
+            }
+
+            std::copy(data, data + length, _data.get());
+            _decodePlan.executeChanged(_data.get(), diff);
+            return;
+        }
+
+        std::copy(data, data + length, _data.get());
+
+        if (_decodeMode == DecodeMode_Lazy) {
+            // Signals decode themselves on their next access
+            ++_dataEpoch;
+            notifyObserver();
+            return;
+        }
+
+        _decodePlan.execute(_data.get());
+        _signalsMatchData = true;
+    }
+
+    /**
+     * @brief Builds the decode plan used by setData from the current signals and length, and locates the signals for packSignal.
+     */
+    void CANMessage::buildDecodePlan() {
+        resolveMultiplexing();
+        for (const auto& signal : _signals) {
+            signal->locate(_length);
+        }
+        if (_selectiveDecoding) {
+            _decodePlan.build(selectSubscribedSignals(), _length);
+        }
+        else {
+            _decodePlan.build(_signals, _length);
+        }
+        updateLazySources();
+
+        // Signals added to the plan may hold values older than the data
+        _signalsMatchData = false;
+    }
+
+    /**
+     * @brief Sets when the signals are decoded from the data.
+     *
+     * @param mode The decode mode.
+     */
+    void CANMessage::setDecodeMode(DecodeMode mode) {
+        if (_decodeMode == DecodeMode_Lazy && mode != DecodeMode_Lazy) {
+            // Bring every signal up to date before they stop decoding on access
+            for (const auto& signal : _signals) {
+                signal->getRawValue();
+            }
+        }
+
+        _decodeMode = mode;
+        if (_decodePlan.isBuilt()) {
+            updateLazySources();
+        }
+    }
+
+    /**
+     * @brief Retrieves when the signals are decoded from the data.
+     *
+     * @return The decode mode.
+     */
+    DecodeMode CANMessage::getDecodeMode() const {
+        return _decodeMode;
+    }
+
+    /**
+     * @brief Restricts decoding to the subscribed signals and the multiplexors they depend on.
+     *
+     * @param selective true to decode only the subscribed signals, false to decode all of them.
+     */
+    void CANMessage::setSelectiveDecoding(bool selective) {
+        if (_selectiveDecoding == selective) {
+            return;
+        }
+
+        _selectiveDecoding = selective;
+        if (_decodePlan.isBuilt()) {
+            buildDecodePlan();
+        }
+    }
+
+    /**
+     * @brief Indicates whether only the subscribed signals are decoded.
+     *
+     * @return true if selective decoding is enabled.
+     */
+    bool CANMessage::isSelectiveDecoding() const {
+        return _selectiveDecoding;
+    }
+
+    /**
+     * @brief Subscribes to a signal of the message, adding it to the decoded signals in selective mode.
+     *
+     * @param signalName The name of the signal.
+     * @return true if the signal exists.
+     */
+    bool CANMessage::subscribeSignal(const std::string& signalName) {
+        auto signal = getSignal(signalName).lock();
+        if (!signal) {
+            Logger::getInstance().log("Cannot subscribe to unknown signal " + signalName + " of message " + _name, Logger::LOG_ERROR);
+            return false;
+        }
+
+        subscribeSignal(*signal);
+        return true;
+    }
+
+    /**
+     * @brief Subscribes to a signal of the message, adding it to the decoded signals in selective mode.
+     *
+     * @param signal The signal, owned by this message.
+     */
+    void CANMessage::subscribeSignal(CANSignal& signal) {
+        bool subscribed = signal.isSubscribed();
+        signal.subscribe();
+        if (_selectiveDecoding && !subscribed && _decodePlan.isBuilt()) {
+            buildDecodePlan();
+        }
+    }
+
+    /**
+     * @brief Withdraws a subscription made with subscribeSignal().
+     *
+     * @param signalName The name of the signal.
+     * @return true if the signal exists.
+     */
+    bool CANMessage::unsubscribeSignal(const std::string& signalName) {
+        auto signal = getSignal(signalName).lock();
+        if (!signal) {
+            return false;
+        }
+
+        unsubscribeSignal(*signal);
+        return true;
+    }
+
+    /**
+     * @brief Withdraws a subscription made with subscribeSignal().
+     *
+     * @param signal The signal, owned by this message.
+     */
+    void CANMessage::unsubscribeSignal(CANSignal& signal) {
+        bool subscribed = signal.isSubscribed();
+        signal.unsubscribe();
+        if (_selectiveDecoding && subscribed && !signal.isSubscribed() && _decodePlan.isBuilt()) {
+            buildDecodePlan();
+        }
+    }
+
+    /**
+     * @brief Indicates whether setData decodes any signal of the message.
+     *
+     * @return false in selective mode when no signal of the message is subscribed, true otherwise.
+     */
+    bool CANMessage::isDecoded() const {
+        return !_selectiveDecoding || _decodePlan.getEntryCount() > 0;
+    }
+
+    /**
+     * @brief Extracts the raw value of a planned signal from the current data.
+     *
+     * @param planIndex The index of the signal entry in the decode plan.
+     * @return The raw value of the signal.
+     */
+    uint64_t CANMessage::extractSignal(size_t planIndex) const {
+        return BitKernel::extract(_data.get(), _decodePlan.getEntry(planIndex).window);
+    }
+
+    /**
+     * @brief Points the signals to this message in lazy mode, or detaches them in eager mode.
+     */
+    void CANMessage::updateLazySources() {
+        bool lazy = _decodeMode == DecodeMode_Lazy;
+        for (const auto& signal : _signals) {
+            size_t planIndex = _decodePlan.findEntry(signal.get());
+            signal->setLazySource(lazy && planIndex < _decodePlan.getEntryCount() ? this : nullptr, planIndex);
         }
-        for (int i = 0; i < length; i++) {
-            _data[i] = data[i];
+    }
+
+    /**
+     * @brief Collects the signals decoded in selective mode: the subscribed ones and their multiplexors.
+     *
+     * Multiplexors are kept so that the plan can select the branches, and isActive() stays correct.
+     *
+     * @return The selected signals, in message order.
+     */
+    std::vector<std::shared_ptr<CANSignal>> CANMessage::selectSubscribedSignals() const {
+        std::set<const CANSignal*> selected;
+        for (const auto& signal : _signals) {
+            if (!signal->isSubscribed()) {
+                continue;
+            }
+            // Walk up the multiplexors, stopping at the ones already selected
+            auto current = signal;
+            while (current && selected.insert(current.get()).second) {
+                current = current->isMultiplexed() ? current->getMultiplexorSignal() : nullptr;
+            }
         }
 
-        for (auto signal : _signals) {
-            signal->decode(_data.get());
+        std::vector<std::shared_ptr<CANSignal>> signals;
+        for (const auto& signal : _signals) {
+            if (selected.count(signal.get())) {
+                signals.push_back(signal);
+            }
+        }
+        return signals;
+    }
+
+    /**
+     * @brief Links every multiplexed signal to its multiplexor signal.
+     */
+    void CANMessage::resolveMultiplexing() {
+        std::shared_ptr<CANSignal> defaultMultiplexor;
+        for (const auto& signal : _signals) {
+            if (signal->isMultiplexor() && !signal->isMultiplexed()) {
+                defaultMultiplexor = signal;
+                break;
+            }
+        }
+
+        for (const auto& signal : _signals) {
+            if (!signal->isMultiplexed()) {
+                continue;
+            }
+
+            std::shared_ptr<CANSignal> multiplexor = defaultMultiplexor;
+            if (!signal->getMultiplexorName().empty()) {
+                multiplexor = getSignal(signal->getMultiplexorName()).lock();
+            }
+
+            if (!multiplexor || multiplexor == signal) {
+                Logger::getInstance().log("Multiplexor of signal " + signal->getName() + " not found in message " + _name, Logger::LOG_ERROR);
+                multiplexor = nullptr;
+            }
+            signal->setMultiplexorSignal(multiplexor);
+        }
+
+        // Break multiplexing loops, they would never be decoded
+        for (const auto& signal : _signals) {
+            auto multiplexor = signal->getMultiplexorSignal();
+            for (size_t depth = 0; multiplexor && depth < _signals.size(); ++depth) {
+                multiplexor = multiplexor->getMultiplexorSignal();
+            }
+            if (multiplexor) {
+                Logger::getInstance().log("Multiplexing loop on signal " + signal->getName() + " in message " + _name, Logger::LOG_ERROR);
+                signal->setMultiplexorSignal(std::weak_ptr<CANSignal>());
+            }
         }
     }
 
@@ -293,33 +621,151 @@ namespace cantools_cpp {
     }
 
     /**
-     * @brief Packs the signals into the message data using the bitwise OR operator.
+     * @brief Packs the signals into the message data.
      *
-     * This function encodes each signal associated with the CAN message and merges the encoded
-     * data into the message data. It then notifies observers of the message update.
+     * The data is cleared, then each signal associated with the CAN message is written in place.
+     * Multiplexed signals are only packed when they are present for the current multiplexor values.
+     * It then notifies observers of the message update.
      */
     void CANMessage::pack() {
-        uint8_t length = _dlc2datalength[_dlc];
-        // Initialize a vector to hold the packed message
-        std::vector<uint8_t> packedData(length, 0);
+        if (!_decodePlan.isBuilt()) {
+            buildDecodePlan();
+        }
+
+        if (_decodeMode == DecodeMode_Lazy) {
+            // Decode every signal from the current data before it is cleared
+            for (const auto& signal : _signals) {
+                signal->getRawValue();
+            }
+        }
 
+        std::fill(_data.get(), _data.get() + _length, 0);
         for (const auto& signal : _signals) {
-            // Encode the signal
-            std::vector<uint8_t> encodedData = signal->encode();
+            if (signal->isActive()) {
+                signal->encodeInto(_data.get());
+            }
+        }
+
+        // Multiplexer branches entered through pack have not been decoded, the next setData decodes everything
+        _signalsMatchData = false;
 
-            // Merge the encoded data into the packedData using bitwise OR
-            for (size_t i = 0; i < encodedData.size(); ++i) {
-                packedData[i] |= encodedData[i];
+        // Notify observers about the updated message
+        notifyObserver();
+    }
+
+    /**
+     * @brief Writes a single signal into the CAN message data in place.
+     *
+     * @param signal The signal to write, owned by this message.
+     */
+    void CANMessage::packSignal(const CANSignal& signal) {
+        if (!_decodePlan.isBuilt()) {
+            buildDecodePlan();
+        }
+
+        if (_updateDepth > 0) {
+            // Inside an update, a multiplexor is only repacked once at commit
+            _updatePending = true;
+            if (signal.isMultiplexor()) {
+                _repackPending = true;
+            }
+            else if (!_repackPending && signal.isActive()) {
+                signal.encodeInto(_data.get());
             }
+            return;
         }
 
-        // Set the packed data to the CAN message
-        for (size_t i = 0; i < packedData.size(); ++i) {
-            _data[i] = packedData[i];
+        if (signal.isMultiplexor()) {
+            pack();
+            return;
+        }
+
+        if (signal.isActive()) {
+            signal.encodeInto(_data.get());
         }
 
-        // Notify observers about the updated message
         notifyObserver();
     }
 
+    /**
+     * @brief Starts a batch of signal writes that are packed and notified once.
+     *
+     * @return The update, committed by commit() or when it goes out of scope.
+     */
+    CANMessage::Update CANMessage::beginUpdate() {
+        return Update(this);
+    }
+
+    CANMessage::Update::Update(CANMessage* message) : _message(message), _open(true) {
+        ++_message->_updateDepth;
+    }
+
+    CANMessage::Update::Update(Update&& other) noexcept : _message(other._message), _open(other._open) {
+        other._message = nullptr;
+        other._open = false;
+    }
+
+    CANMessage::Update::~Update() {
+        commit();
+    }
+
+    CANMessage::Update& CANMessage::Update::setRawValue(CANSignal& signal, uint64_t value) {
+        signal.setRawValue(value);
+        return *this;
+    }
+
+    CANMessage::Update& CANMessage::Update::setRawValue(const std::string& signalName, uint64_t value) {
+        if (CANSignal* signal = findSignal(signalName)) {
+            setRawValue(*signal, value);
+        }
+        return *this;
+    }
+
+    CANMessage::Update& CANMessage::Update::setPhysicalValue(CANSignal& signal, double value) {
+        signal.setPhysicalValue(value);
+        return *this;
+    }
+
+    CANMessage::Update& CANMessage::Update::setPhysicalValue(const std::string& signalName, double value) {
+        if (CANSignal* signal = findSignal(signalName)) {
+            setPhysicalValue(*signal, value);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Packs the message if needed and notifies its observers once.
+     */
+    void CANMessage::Update::commit() {
+        if (!_open) {
+            return;
+        }
+
+        _open = false;
+        if (--_message->_updateDepth > 0 || !_message->_updatePending) {
+            return;
+        }
+
+        bool repack = _message->_repackPending;
+        _message->_updatePending = false;
+        _message->_repackPending = false;
+        if (repack) {
+            _message->pack();
+        }
+        else {
+            _message->notifyObserver();
+        }
+    }
+
+    CANSignal* CANMessage::Update::findSignal(const std::string& signalName) const {
+        CANSignal* signal = nullptr;
+        if (_message) {
+            signal = _message->getSignal(signalName).lock().get();
+        }
+        if (!signal) {
+            Logger::getInstance().log("Update of unknown signal " + signalName, Logger::LOG_ERROR);
+        }
+        return signal;
+    }
+
 } // namespace cantools_cpp
@@ -15,22 +15,117 @@
 
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include <map>
 #include <iostream>
 #include "CANSignal.hpp"
 #include "SignalGroup.hpp"
 #include "IBusObserver.hpp"
+#include "DecodePlan.hpp"
+#include "Handles.hpp"
+#include "StringPool.hpp"
+#include "ObjectView.hpp"
 
 namespace cantools_cpp {
 
+    /**
+     * @enum DecodeMode
+     * @brief Specifies when the signals of a message are decoded from its data.
+     */
+    enum DecodeMode
+    {
+        DecodeMode_Eager,  ///< setData decodes every present signal and notifies the signal observers
+        DecodeMode_Lazy,   ///< setData only stores the data, each signal decodes on its first access
+        DecodeMode_OnChange  ///< setData only decodes and notifies the signals whose bits changed
+    };
+
     class CANMessage {
     public:
+        /**
+         * @brief Batch of signal writes packed and notified once, obtained from beginUpdate().
+         *
+         * Each write is applied to the message data right away, but the message observers are only
+         * notified once, when the update is committed. If a multiplexor is written, the message is
+         * repacked once at commit. An update that goes out of scope is committed.
+         */
+        class Update {
+        public:
+            Update(Update&& other) noexcept;
+            Update(const Update&) = delete;
+            Update& operator=(const Update&) = delete;
+            Update& operator=(Update&&) = delete;
+            ~Update();
+
+            /**
+             * @brief Sets the raw value of a signal of the message.
+             *
+             * @param signal The signal to write, owned by the message.
+             * @param value The raw value.
+             * @return This update, to chain writes.
+             */
+            Update& setRawValue(CANSignal& signal, uint64_t value);
+
+            /**
+             * @brief Sets the raw value of a signal of the message by name.
+             *
+             * @param signalName The name of the signal, unknown names are logged and ignored.
+             * @param value The raw value.
+             * @return This update, to chain writes.
+             */
+            Update& setRawValue(const std::string& signalName, uint64_t value);
+
+            /**
+             * @brief Sets the physical value of a signal of the message.
+             *
+             * @param signal The signal to write, owned by the message.
+             * @param value The physical value.
+             * @return This update, to chain writes.
+             */
+            Update& setPhysicalValue(CANSignal& signal, double value);
+
+            /**
+             * @brief Sets the physical value of a signal of the message by name.
+             *
+             * @param signalName The name of the signal, unknown names are logged and ignored.
+             * @param value The physical value.
+             * @return This update, to chain writes.
+             */
+            Update& setPhysicalValue(const std::string& signalName, double value);
+
+            /**
+             * @brief Packs the message if needed and notifies its observers once.
+             *
+             * Further writes through this update are applied and notified on their own.
+             */
+            void commit();
+
+        private:
+            friend class CANMessage;
+
+            explicit Update(CANMessage* message);
+
+            /**
+             * @brief Finds a signal of the message by name, logging unknown names.
+             */
+            CANSignal* findSignal(const std::string& signalName) const;
+
+            CANMessage* _message;  ///< Message being updated, nullptr once moved from.
+            bool _open;            ///< Whether the update has not been committed yet.
+        };
+
         /**
          * @brief Constructor to create a CAN message with a specified ID.
          *
          * @param id Unique identifier for the CAN message.
+         * @param stringPool The pool interning the transmitter names, the shared pool if nullptr.
+         * @param memory The resource allocating the observer list, usually the arena of the bus, the heap if nullptr.
          */
-        CANMessage(uint32_t id);
+        CANMessage(uint32_t id, std::shared_ptr<StringPool> stringPool = nullptr, std::pmr::memory_resource* memory = nullptr);
+
+        /**
+         * @brief Destructor, detaches the signals that still point to the message.
+         */
+        ~CANMessage();
 
         /**
          * @brief Adds a signal to the CAN message.
@@ -70,7 +165,7 @@ namespace cantools_cpp {
          *
          * @return The transmitter of the CAN message.
          */
-        std::string getTransmitter() const;
+        const std::string& getTransmitter() const;
 
         /**
          * @brief Retrieves any additional transmitters associated with the CAN message.
@@ -96,9 +191,23 @@ namespace cantools_cpp {
         /**
          * @brief Retrieves the signals associated with the CAN message.
          *
-         * @return A vector of shared pointers to CANSignal objects.
+         * @return A reference to the vector of shared pointers to CANSignal objects.
+         */
+        const std::vector<std::shared_ptr<CANSignal>>& getSignals() const;
+
+        /**
+         * @brief Retrieves a view over the signals, iterated without copies nor reference counting.
+         *
+         * @return A view yielding CANSignal references.
          */
-        std::vector<std::shared_ptr<CANSignal>> getSignals();
+        ObjectView<CANSignal> getSignalView() { return ObjectView<CANSignal>(_signals); }
+
+        /**
+         * @brief Retrieves a read-only view over the signals.
+         *
+         * @return A view yielding const CANSignal references.
+         */
+        ObjectView<const CANSignal> getSignalView() const { return ObjectView<const CANSignal>(_signals); }
 
         /**
          * @brief Retrieves the cycle time for the CAN message.
@@ -164,7 +273,7 @@ namespace cantools_cpp {
         std::shared_ptr<uint8_t[]> getData();
 
         /**
-         * @brief Sets the data for the CAN message.
+         * @brief Sets the data for the CAN message and decodes its signals through the decode plan.
          *
          * @param data Pointer to the data to set.
          * @param length Length of the data.
@@ -193,6 +302,31 @@ namespace cantools_cpp {
          */
         void pack();
 
+        /**
+         * @brief Writes a single signal into the CAN message data in place.
+         *
+         * Only the bits of the signal change, other signals and unused bits keep their values. A
+         * multiplexor may change which signals are present, so the whole message is packed instead.
+         *
+         * @param signal The signal to write, owned by this message.
+         */
+        void packSignal(const CANSignal& signal);
+
+        /**
+         * @brief Starts a batch of signal writes that are packed and notified once.
+         *
+         * @code
+         * auto update = message->beginUpdate();
+         * update.setRawValue("Counter", counter).setPhysicalValue("Speed", 42.0);
+         * update.commit();
+         * @endcode
+         *
+         * Updates may be nested, only the outermost commit notifies the observers.
+         *
+         * @return The update, committed by commit() or when it goes out of scope.
+         */
+        Update beginUpdate();
+
         /**
          * @brief Retrieves a signal by name, returning a weak pointer.
          *
@@ -201,7 +335,149 @@ namespace cantools_cpp {
          */
         std::weak_ptr<CANSignal> getSignal(std::string name);
 
+        /**
+         * @brief Finds the position of a signal in the message from its name, used as its handle.
+         *
+         * @param name The name of the signal.
+         * @return The position of the signal, or InvalidHandle if not found.
+         */
+        uint32_t findSignalPosition(const std::string& name) const;
+
+        /**
+         * @brief Retrieves a signal from its position in the message.
+         *
+         * @param position The position of the signal.
+         * @return The signal, or nullptr if the position is out of range.
+         */
+        CANSignal* getSignalAt(uint32_t position) const {
+            return position < _signals.size() ? _signals[position].get() : nullptr;
+        }
+
+        /**
+         * @brief Builds the decode plan used by setData from the current signals and length, and locates the signals for packSignal.
+         *
+         * Called by CANBus::build() once all signals are attached, and again whenever the length changes.
+         */
+        void buildDecodePlan();
+
+        /**
+         * @brief Sets when the signals are decoded from the data.
+         *
+         * In lazy mode, setData only copies the data and notifies the message observers once; signal
+         * observers are not notified and signal values are decoded and cached on their first access.
+         * In on-change mode, setData only decodes and notifies the signals whose bits differ from the
+         * previous data, plus the signals of multiplexer branches that just became present.
+         *
+         * @param mode The decode mode.
+         */
+        void setDecodeMode(DecodeMode mode);
+
+        /**
+         * @brief Retrieves when the signals are decoded from the data.
+         *
+         * @return The decode mode.
+         */
+        DecodeMode getDecodeMode() const;
+
+        /**
+         * @brief Restricts decoding to the subscribed signals and the multiplexors they depend on.
+         *
+         * The other signals are no longer decoded by setData nor on access, they keep their last values.
+         * A message without any subscribed signal only stores its data.
+         *
+         * @param selective true to decode only the subscribed signals, false to decode all of them.
+         */
+        void setSelectiveDecoding(bool selective);
+
+        /**
+         * @brief Indicates whether only the subscribed signals are decoded.
+         *
+         * @return true if selective decoding is enabled.
+         */
+        bool isSelectiveDecoding() const;
+
+        /**
+         * @brief Subscribes to a signal of the message, adding it to the decoded signals in selective mode.
+         *
+         * @param signalName The name of the signal.
+         * @return true if the signal exists.
+         */
+        bool subscribeSignal(const std::string& signalName);
+
+        /**
+         * @brief Subscribes to a signal of the message, adding it to the decoded signals in selective mode.
+         *
+         * @param signal The signal, owned by this message.
+         */
+        void subscribeSignal(CANSignal& signal);
+
+        /**
+         * @brief Withdraws a subscription made with subscribeSignal().
+         *
+         * @param signalName The name of the signal.
+         * @return true if the signal exists.
+         */
+        bool unsubscribeSignal(const std::string& signalName);
+
+        /**
+         * @brief Withdraws a subscription made with subscribeSignal().
+         *
+         * @param signal The signal, owned by this message.
+         */
+        void unsubscribeSignal(CANSignal& signal);
+
+        /**
+         * @brief Indicates whether setData decodes any signal of the message.
+         *
+         * @return false in selective mode when no signal of the message is subscribed, true otherwise.
+         */
+        bool isDecoded() const;
+
+        /**
+         * @brief Retrieves the data epoch, incremented each time setData stores new data in lazy mode.
+         *
+         * @return The data epoch.
+         */
+        uint64_t getDataEpoch() const { return _dataEpoch; }
+
+        /**
+         * @brief Extracts the raw value of a planned signal from the current data.
+         *
+         * @param planIndex The index of the signal entry in the decode plan.
+         * @return The raw value of the signal.
+         */
+        uint64_t extractSignal(size_t planIndex) const;
+
     private:
+        /**
+         * @brief Points the signals to this message in lazy mode, or detaches them in eager mode.
+         */
+        void updateLazySources();
+
+        /**
+         * @brief Collects the signals decoded in selective mode: the subscribed ones and their multiplexors.
+         *
+         * @return The selected signals, in message order.
+         */
+        std::vector<std::shared_ptr<CANSignal>> selectSubscribedSignals() const;
+
+        /**
+         * @brief Links every multiplexed signal to its multiplexor signal.
+         *
+         * The multiplexor is the one named by SG_MUL_VAL_, or else the multiplexor of the message that is
+         * not multiplexed itself. Signals whose multiplexor is missing or would loop are handled as plain signals.
+         */
+        void resolveMultiplexing();
+
+        /**
+         * @brief Allocates a zeroed data buffer for the given length.
+         *
+         * The buffer is never shorter than 8 bytes so that decoders may always read whole words.
+         *
+         * @param length The data length of the CAN message.
+         */
+        void allocateData(int length);
+
         /**
          * @brief Notifies all observers of the CAN message about changes.
          */
@@ -214,14 +490,23 @@ namespace cantools_cpp {
         std::string _name;  ///< Name of the CAN message.
         int _dlc;  ///< Data Length Code (DLC) of the CAN message.
         int _length; ///< Data Length of the CAN message.
-        std::string _transmitter;  ///< Transmitter of the CAN message.
-        std::vector<std::string> _additionalTransmitters;  ///< Additional transmitters for the CAN message.
+        std::shared_ptr<StringPool> _stringPool;  ///< Pool holding the transmitter names.
+        const std::string* _transmitter;  ///< Transmitter of the CAN message.
+        std::vector<const std::string*> _additionalTransmitters;  ///< Additional transmitters for the CAN message.
         static const uint8_t _dlc2datalength[];  ///< Array to map DLC to data length.
         static const std::map<uint8_t, uint8_t> _datalength2dlc;  ///< Map data length to DLC.
         std::shared_ptr<uint8_t[]> _data;  ///< Pointer to the message data.
         float _cycle;  ///< Cycle time for the CAN message.
-
-        std::vector<IBusObserver*> _observers;  ///< Observers for the CAN message.
+        DecodePlan _decodePlan;  ///< Precompiled layout used to decode the signals in setData.
+        DecodeMode _decodeMode;  ///< When the signals are decoded from the data.
+        uint64_t _dataEpoch;  ///< Incremented by setData in lazy mode, signals compare it with their own.
+        bool _signalsMatchData;  ///< Whether the present signals hold the values decoded from _data, required by on-change mode.
+        bool _selectiveDecoding;  ///< Whether only the subscribed signals are decoded.
+        int _updateDepth;  ///< Number of open updates, packing and notifications are deferred while positive.
+        bool _updatePending;  ///< Whether a signal was written during the open updates.
+        bool _repackPending;  ///< Whether a multiplexor was written during the open updates.
+
+        std::pmr::vector<IBusObserver*> _observers;  ///< Observers for the CAN message.
     };
 
 } // namespace cantools_cpp
@@ -48,10 +48,7 @@ namespace cantools_cpp
 
     void CANNode::addMessage(const std::shared_ptr<CANMessage>& msg) {
         // Check if a message with the same name already exists in the _txMessages
-        bool exists = std::any_of(_txMessages.begin(), _txMessages.end(),
-            [&msg](const std::shared_ptr<CANMessage>& existingMsg) {
-                return existingMsg->getName() == msg->getName();
-            });
+        bool exists = !_txMessageNames.insert(msg->getName()).second;
 
         if (!exists) {
             // If no message with the same name exists, add it to the local storage and the connected bus
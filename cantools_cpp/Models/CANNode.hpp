@@ -16,6 +16,7 @@
 
 #include <string>
 #include <iostream>
+#include <unordered_set>
 #include "CANMessage.hpp"
 
 namespace cantools_cpp
@@ -28,6 +29,7 @@ namespace cantools_cpp
         std::string _nodeName; ///< The name of the CAN node.
         std::weak_ptr<CANBus> _connectedBus; ///< Weak reference to the CANBus this node is attached to.
         std::vector<std::shared_ptr<CANMessage>> _txMessages; ///< List of messages to be transmitted by this node.
+        std::unordered_set<std::string> _txMessageNames; ///< Names of the messages in _txMessages, to reject duplicates without a scan.
 
         bool _isAttachedToBus; ///< Flag indicating whether the node is attached to a CAN bus.
 
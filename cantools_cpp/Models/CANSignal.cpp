@@ -5,10 +5,13 @@
  * @date: 10/02/2024
  */
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
 #include "CANSignal.hpp"
 #include "CANMessage.hpp"
 #include "Logger.hpp"
-#include "Util.hpp"
+#include "BitKernel.hpp"
 
 namespace cantools_cpp
 {
@@ -26,35 +29,65 @@ namespace cantools_cpp
      * @param valType The value type (signed, unsigned, float, double).
      * @param receiver The receiving node for this signal.
      * @param multiplexer The multiplexer group for this signal.
+     * @param stringPool The pool interning the unit, receiver and multiplexer strings, the shared pool if nullptr.
+     * @param table The table receiving the fields of the signal, a table of its own if nullptr.
+     * @param memory The resource allocating the observer list, usually the arena of the bus, the heap if nullptr.
      */
-    CANSignal::CANSignal(const std::string& name, uint8_t startBit, uint8_t length, float factor, float offset, float minVal, float maxVal, std::string unit, uint8_t byteOrder, uint8_t valType, std::string receiver, std::string multiplexer)
-        : _name(name), _startBit(startBit), _length(length), _factor(factor), _offset(offset), _minVal(minVal), _maxVal(maxVal), _unit(unit), _byteOrder(byteOrder), _receiver(receiver), _rawValue(0), _valueType(DbcValueType(valType)), _multiplexer(multiplexer)
+    CANSignal::CANSignal(const std::string& name, uint8_t startBit, uint8_t length, float factor, float offset, float minVal, float maxVal, const std::string& unit, uint8_t byteOrder, uint8_t valType, const std::string& receiver, const std::string& multiplexer,
+        std::shared_ptr<StringPool> stringPool, std::shared_ptr<SignalTable> table, std::pmr::memory_resource* memory)
+        : _observers(memory ? memory : std::pmr::get_default_resource()), _stringPool(stringPool ? std::move(stringPool) : StringPool::getShared()), _table(table ? std::move(table) : std::make_shared<SignalTable>())
     {
-        _physicalValue = static_cast<double>(_rawValue) * _factor + _offset;
+        _row = _table->addRow(name, startBit, length, byteOrder, valType, factor, offset, minVal, maxVal,
+            &_stringPool->intern(unit), &_stringPool->intern(receiver), &_stringPool->intern(multiplexer));
+        _table->setValue(_row, 0, offset);
+        _multiplexorName = &_stringPool->intern(std::string());
+
+        // Multiplexer indicator: "M" for a multiplexor, "mN" for a signal present when the multiplexor is N, "mNM" for both
+        _isMultiplexor = multiplexer == "M";
+        if (multiplexer.size() > 1 && multiplexer[0] == 'm') {
+            bool multiplexor = multiplexer.back() == 'M';
+            const char* first = multiplexer.data() + 1;
+            const char* last = multiplexer.data() + multiplexer.size() - (multiplexor ? 1 : 0);
+            uint64_t value = 0;
+            auto result = std::from_chars(first, last, value);
+            if (first < last && result.ec == std::errc() && result.ptr == last) {
+                _multiplexerValues.push_back({ value, value });
+                _isMultiplexor = multiplexor;
+            }
+        }
+        if (!multiplexer.empty() && !_isMultiplexor && _multiplexerValues.empty()) {
+            Logger::getInstance().log("Error: Invalid multiplexer indicator " + multiplexer + " of signal " + name + ", loaded as a plain signal",
+                Logger::LOG_ERROR);
+        }
     }
 
     // Getters
-    std::string CANSignal::getName() const { return _name; }
-    uint8_t CANSignal::getStartBit() const { return _startBit; }
-    uint8_t CANSignal::getLength() const { return _length; }
-    float CANSignal::getFactor() const { return _factor; }
-    float CANSignal::getOffset() const { return _offset; }
-    uint64_t CANSignal::getRawValue() const { return _rawValue; }
-    double CANSignal::getPhysicalValue() const { return _physicalValue; }
-    DbcValueType CANSignal::getValueType() const { return _valueType; }
-    uint8_t CANSignal::getByteOrder() const { return _byteOrder; }
-    float CANSignal::getMinVal() const { return _minVal; }
-    float CANSignal::getMaxVal() const { return _maxVal; }
-    std::string CANSignal::getUnit() const { return _unit; }
-    std::string CANSignal::getReceiver() const { return _receiver; }
-    std::string CANSignal::getMultiplexer() const { return _multiplexer; }
+    std::string CANSignal::getName() const { return _table->getName(_row); }
+    uint8_t CANSignal::getStartBit() const { return static_cast<uint8_t>(_table->getStartBit(_row)); }
+    uint8_t CANSignal::getLength() const { return static_cast<uint8_t>(_table->getLength(_row)); }
+    float CANSignal::getFactor() const { return _table->getFactor(_row); }
+    float CANSignal::getOffset() const { return _table->getOffset(_row); }
+    uint64_t CANSignal::getRawValue() const { refresh(); return _table->getRawValue(_row); }
+    double CANSignal::getPhysicalValue() const { refresh(); return _table->getPhysicalValue(_row); }
+    DbcValueType CANSignal::getValueType() const { return DbcValueType(_table->getValueType(_row)); }
+    uint8_t CANSignal::getByteOrder() const { return _table->getByteOrder(_row); }
+    float CANSignal::getMinVal() const { return _table->getMinVal(_row); }
+    float CANSignal::getMaxVal() const { return _table->getMaxVal(_row); }
+    const std::string& CANSignal::getUnit() const { return _table->getUnit(_row); }
+    const std::string& CANSignal::getReceiver() const { return _table->getReceiver(_row); }
+    const std::string& CANSignal::getMultiplexer() const { return _table->getMultiplexer(_row); }
+    bool CANSignal::isMultiplexor() const { return _isMultiplexor; }
+    bool CANSignal::isMultiplexed() const { return !_multiplexerValues.empty(); }
+    const std::string& CANSignal::getMultiplexorName() const { return *_multiplexorName; }
+    std::shared_ptr<CANSignal> CANSignal::getMultiplexorSignal() const { return _multiplexorSignal.lock(); }
+    const std::vector<MultiplexerRange>& CANSignal::getMultiplexerValues() const { return _multiplexerValues; }
 
     // Setters
-    void CANSignal::setName(const std::string& name) { _name = name; }
-    void CANSignal::setStartBit(uint8_t startBit) { _startBit = startBit; }
-    void CANSignal::setLength(uint8_t length) { _length = length; }
-    void CANSignal::setFactor(float factor) { _factor = factor; }
-    void CANSignal::setOffset(float offset) { _offset = offset; }
+    void CANSignal::setName(const std::string& name) { _table->setName(_row, name); }
+    void CANSignal::setStartBit(uint8_t startBit) { _table->setStartBit(_row, startBit); }
+    void CANSignal::setLength(uint8_t length) { _table->setLength(_row, length); }
+    void CANSignal::setFactor(float factor) { _table->setFactor(_row, factor); }
+    void CANSignal::setOffset(float offset) { _table->setOffset(_row, offset); }
 
     /**
      * @brief Sets the raw value of the signal and calculates the physical value.
@@ -62,17 +95,19 @@ namespace cantools_cpp
      * @param value The raw signal value.
      */
     void CANSignal::setRawValue(uint64_t value) {
-        // Calculate the maximum possible value for the raw value based on the bit length
-        uint64_t maxRawValue = (1ULL << _length) - 1; // 2^_length - 1
+        // Catch up with the lazily decoded data first, so the new value is not overwritten on the next access
+        refresh();
 
         // Cap the raw value to the maximum allowed by the bit length
-        _rawValue = std::min(value, maxRawValue);
+        uint64_t rawValue = std::min(value, getRawMask());
 
-        // Calculate the physical value based on the factor and offset
-        _physicalValue = static_cast<double>(_rawValue) * _factor + _offset;
+        // Calculate the physical value based on the value type, factor and offset
+        _table->setValue(_row, rawValue, rawToPhysical(rawValue));
 
-        // Trigger a re-pack of the parent
-        _parent.lock()->pack();
+        // Write the new value into the parent's data
+        if (_message) {
+            _message->packSignal(*this);
+        }
     }
 
     /**
@@ -81,32 +116,214 @@ namespace cantools_cpp
      * @param value The physical signal value.
      */
     void CANSignal::setPhysicalValue(double value) {
-        // Set the physical value and calculate the corresponding raw value
-        _physicalValue = value;
+        // Catch up with the lazily decoded data first, so the new value is not overwritten on the next access
+        refresh();
 
         // Calculate the raw value based on the physical value, factor, and offset
-        _rawValue = static_cast<uint64_t>(((_physicalValue - _offset) / _factor));
+        uint64_t rawValue = physicalToRaw(value);
 
-        // Calculate the maximum possible value for the raw value based on the bit length
-        uint64_t maxRawValue = (1ULL << _length) - 1; // 2^_length - 1
+        // Recalculate the physical value to reflect the rounded and capped raw value
+        _table->setValue(_row, rawValue, rawToPhysical(rawValue));
 
-        // Cap the raw value to the maximum allowed by the bit length
-        _rawValue = std::min(_rawValue, maxRawValue);
+        // Write the new value into the parent's data
+        if (_message) {
+            _message->packSignal(*this);
+        }
+    }
+
+    void CANSignal::setValueType(DbcValueType valueType) { _table->setValueType(_row, static_cast<uint8_t>(valueType)); }
+    void CANSignal::setMultiplexorSignal(std::weak_ptr<CANSignal> multiplexor) {
+        _multiplexorSignal = multiplexor;
+
+        // Locked once here, so that isActive() never touches the reference count of the multiplexor
+        _multiplexor = multiplexor.lock().get();
+    }
+
+    /**
+     * @brief Makes the signal decode itself on access from the data of a message in lazy decode mode.
+     * @param message The message holding the data, or nullptr to stop decoding on access.
+     * @param planIndex The index of the signal entry in the message's decode plan.
+     */
+    void CANSignal::setLazySource(const CANMessage* message, size_t planIndex)
+    {
+        _lazySource = message;
+        _planIndex = planIndex;
+
+        // Decode from the current data on the next access
+        _decodedEpoch = message ? message->getDataEpoch() - 1 : 0;
+    }
+
+    /**
+     * @brief Registers interest in the signal, so that messages decoding selectively keep decoding it.
+     */
+    void CANSignal::subscribe()
+    {
+        ++_subscriberCount;
+    }
+
+    /**
+     * @brief Withdraws an interest registered with subscribe().
+     */
+    void CANSignal::unsubscribe()
+    {
+        if (_subscriberCount > 0) {
+            --_subscriberCount;
+        }
+    }
+
+    /**
+     * @brief Indicates whether the signal has at least one subscriber.
+     * @return true if subscribe() has been called more often than unsubscribe().
+     */
+    bool CANSignal::isSubscribed() const
+    {
+        return _subscriberCount > 0;
+    }
+
+    /**
+     * @brief Decodes the signal from its lazy source if the data changed since the last access.
+     *
+     * Multiplexed signals that are not present keep their last values, as in eager mode.
+     */
+    void CANSignal::refresh() const
+    {
+        if (!_lazySource || _decodedEpoch == _lazySource->getDataEpoch()) {
+            return;
+        }
+
+        _decodedEpoch = _lazySource->getDataEpoch();
+        if (isActive()) {
+            uint64_t rawValue = _lazySource->extractSignal(_planIndex);
+            _table->setValue(_row, rawValue, rawToPhysical(rawValue));
+        }
+    }
+
+    /**
+     * @brief Sets the extended multiplexing of the signal (SG_MUL_VAL_), replacing the "mN" value.
+     * @param multiplexorName The name of the multiplexor.
+     * @param values The multiplexor values for which the signal is present.
+     */
+    void CANSignal::setMultiplexerValues(const std::string& multiplexorName, const std::vector<MultiplexerRange>& values)
+    {
+        _multiplexorName = &_stringPool->intern(multiplexorName);
+        _multiplexerValues = values;
+    }
 
-        // Recalculate the physical value to reflect the capped raw value
-        _physicalValue = static_cast<double>(_rawValue) * _factor + _offset;
+    /**
+     * @brief Indicates whether the signal is present for the given multiplexor value.
+     * @param value The raw value of the multiplexor.
+     * @return true if one of the multiplexer ranges contains the value.
+     */
+    bool CANSignal::isMultiplexerValue(uint64_t value) const
+    {
+        return std::any_of(_multiplexerValues.begin(), _multiplexerValues.end(), [value](const MultiplexerRange& range) {
+            return range.low <= value && value <= range.high;
+            });
+    }
 
-        // Trigger a re-pack of the parent
-        _parent.lock()->pack();
+    /**
+     * @brief Indicates whether the signal is present in the current message data.
+     * @return true for plain signals, or when the multiplexor is active and holds one of the multiplexer values.
+     */
+    bool CANSignal::isActive() const
+    {
+        // Signals without multiplexer values or with unresolved multiplexing are handled as plain ones
+        for (const CANSignal* signal = this; !signal->_multiplexerValues.empty() && signal->_multiplexor; signal = signal->_multiplexor) {
+            if (!signal->isMultiplexerValue(signal->_multiplexor->getRawValue())) {
+                return false;
+            }
+        }
+        return true;
     }
 
-    void CANSignal::setValueType(DbcValueType valueType) { _valueType = valueType; }
+    /**
+     * @brief Returns the mask covering the bits of the signal.
+     */
+    uint64_t CANSignal::getRawMask() const {
+        uint16_t length = _table->getLength(_row);
+        return length >= 64 ? ~0ULL : (1ULL << length) - 1;
+    }
+
+    /**
+     * @brief Converts a raw bit pattern into the physical value, according to the value type.
+     * @param rawValue The raw bit pattern of the signal.
+     * @return The physical value.
+     */
+    double CANSignal::rawToPhysical(uint64_t rawValue) const {
+        double value;
+        switch (_table->getValueType(_row)) {
+        case Signed:
+            value = static_cast<double>(BitKernel::signExtend(rawValue, getRawMask() ^ (getRawMask() >> 1)));
+            break;
+        case IEEEFloat:
+            value = BitKernel::toFloat(rawValue);
+            break;
+        case IEEEDouble:
+            value = BitKernel::toDouble(rawValue);
+            break;
+        default:
+            value = static_cast<double>(rawValue);
+            break;
+        }
+        return value * _table->getFactor(_row) + _table->getOffset(_row);
+    }
+
+    /**
+     * @brief Converts a physical value into the raw bit pattern, according to the value type.
+     * @param physicalValue The physical value.
+     * @return The raw bit pattern of the signal.
+     */
+    uint64_t CANSignal::physicalToRaw(double physicalValue) const {
+        double scaled = (physicalValue - _table->getOffset(_row)) / _table->getFactor(_row);
+
+        switch (_table->getValueType(_row)) {
+        case IEEEFloat:
+            return BitKernel::fromFloat(static_cast<float>(scaled));
+        case IEEEDouble:
+            return BitKernel::fromDouble(scaled);
+        default:
+            break;
+        }
+
+        scaled = std::round(scaled);
+        uint64_t mask = getRawMask();
+
+        if (std::isnan(scaled)) {
+            return 0;
+        }
+
+        if (_table->getValueType(_row) == Signed) {
+            // Saturate to [-2^(n-1), 2^(n-1) - 1], then keep the two's complement bits of the signal
+            double limit = std::ldexp(1.0, _table->getLength(_row) - 1);
+            int64_t value;
+            if (scaled >= limit) {
+                value = static_cast<int64_t>(mask >> 1);
+            }
+            else if (scaled < -limit) {
+                value = -static_cast<int64_t>(mask >> 1) - 1;
+            }
+            else {
+                value = static_cast<int64_t>(scaled);
+            }
+            return static_cast<uint64_t>(value) & mask;
+        }
+
+        // Saturate to [0, 2^n - 1]
+        if (!(scaled > 0.0)) {
+            return 0;
+        }
+        if (scaled >= std::ldexp(1.0, _table->getLength(_row))) {
+            return mask;
+        }
+        return static_cast<uint64_t>(scaled);
+    }
 
     /**
      * @brief Displays the signal name and raw value using the Logger.
      */
     void CANSignal::display() const {
-        Logger::getInstance().log("Signal: " + _name + ", Value: " + std::to_string(_rawValue), Logger::LOG_INFO);
+        refresh();
+        Logger::getInstance().log("Signal: " + getName() + ", Value: " + std::to_string(_table->getRawValue(_row)), Logger::LOG_INFO);
     }
 
     /**
@@ -116,6 +333,44 @@ namespace cantools_cpp
     void CANSignal::setParent(std::weak_ptr<CANMessage> parent)
     {
         _parent = parent;
+
+        // Locked once here, so that the frame paths never touch the reference count of the parent
+        _message = parent.lock().get();
+    }
+
+    /**
+     * @brief Forgets the parent message, called by the message when it is destroyed.
+     * @param message The message being destroyed; the call is ignored if it is not the parent.
+     */
+    void CANSignal::releaseParent(const CANMessage* message)
+    {
+        if (_message == message) {
+            _message = nullptr;
+            // The multiplexor belongs to the same message and may go with it
+            _multiplexor = nullptr;
+        }
+    }
+
+    /**
+     * @brief Moves the fields of the signal to a row of another table, e.g. the table of its bus.
+     *
+     * The previous row is left behind, it is released with its table.
+     *
+     * @param table The table receiving the signal.
+     */
+    void CANSignal::moveToTable(const std::shared_ptr<SignalTable>& table)
+    {
+        if (!table || table == _table) {
+            return;
+        }
+        _row = table->copyRow(*_table, _row);
+        _table = table;
+    }
+
+    void CANSignal::followRows(const std::shared_ptr<SignalTable>& table, uint32_t offset)
+    {
+        _row += offset;
+        _table = table;
     }
 
     std::weak_ptr<CANMessage> CANSignal::getParent() const {
@@ -128,78 +383,91 @@ namespace cantools_cpp
      */
     void CANSignal::decode(const uint8_t* data)
     {
-        auto startBit = _startBit;
-
         // Get the length from the parent message
-        auto parent = _parent.lock(); // Use lock to get a shared_ptr from weak_ptr
-        if (!parent) {
+        if (!_message) {
             throw std::runtime_error("Parent message not available");
         }
 
-        int length = parent->getLength();
-
-        // Create a vector from the data with the length
-        std::vector<uint8_t> tempArray(data, data + length);
+        int length = _message->getLength();
 
-        if (_byteOrder != ByteOrder_LSB)
-        {
-            // Reverse the array
-            std::reverse(tempArray.begin(), tempArray.end());
+        BitKernel::Window window = BitKernel::locate(getStartBit(), getLength(), getByteOrder() != ByteOrder_LSB, length);
 
-            startBit = Util::getInstance().getStartBitLE(*this, length);
+        uint64_t rawValue;
+        if (length >= 8) {
+            rawValue = BitKernel::extract(data, window);
+        }
+        else {
+            // Short frames are padded to a full word for the kernel
+            uint8_t padded[8] = {};
+            std::copy(data, data + length, padded);
+            rawValue = BitKernel::extract(padded, window);
         }
 
-        uint64_t rawValue = Util::getInstance().extractBits(tempArray, startBit, _length);
-
-        // Calculate the physical value using scaling and offset
-        double physicalValue = rawValue * _factor + _offset;
+        // Calculate the physical value using the value type, scaling and offset
+        double physicalValue = rawToPhysical(rawValue);
 
         //if (_rawValue != rawValue || _physicalValue != physicalValue)
         //{
-            _rawValue = rawValue;
-            _physicalValue = physicalValue;
+            _table->setValue(_row, rawValue, physicalValue);
             notifyObserver();
         //}
     }
 
+    /**
+     * @brief Stores values decoded by the parent's DecodePlan and notifies the observers.
+     * @param rawValue The decoded raw value.
+     * @param physicalValue The decoded physical value.
+     */
+    void CANSignal::setDecodedValue(uint64_t rawValue, double physicalValue)
+    {
+        _table->setValue(_row, rawValue, physicalValue);
+        notifyObserver();
+    }
+
     /**
      * @brief Encodes the signal's raw value into a byte vector based on the specified byte order.
      *
-     * This function converts the signal's raw value into a vector of bytes. The encoding
-     * is done according to the byte order (Little Endian or Big Endian) specified in the
-     * _byteOrder member variable. The encoded bytes are placed in the correct positions
-     * in the resulting vector based on the start bit and length of the signal.
+     * The raw value is written into a zeroed frame of the parent's length, at the position given by
+     * the start bit, length and byte order of the signal.
      *
      * @return A vector of bytes representing the encoded signal value.
      */
     std::vector<uint8_t> CANSignal::encode() {
-        std::vector<uint8_t> ret(_parent.lock()->getLength(), 0);
+        refresh();
 
-        auto startBit = _startBit;
-
-        if (_byteOrder == ByteOrder_MSB) {
-            // Big Endian encoding, convert it to little endian
-            startBit = Util::getInstance().getStartBitLE(*this, _parent.lock()->getLength());
+        if (!_message) {
+            throw std::runtime_error("Parent message not available");
         }
 
-        uint16_t startByte = startBit / 8;
-        uint16_t endByte = (startBit + _length - 1) / 8;
-        uint16_t lengthByte = (endByte - startByte) + 1;
-        uint16_t startBitInByte = startBit % 8;
+        int length = _message->getLength();
 
-        for (uint8_t i = 0; i < lengthByte; ++i) {
-            // Set the value in the correct byte position
-            ret[startByte + i] |= static_cast<uint8_t>(((_rawValue << startBitInByte) >> (8 * i)) & 0xFF);
-        }
-
-        if (_byteOrder == ByteOrder_MSB) {
-            // Big Endian encoding, convert it back to big endian
-            ret = Util::getInstance().mirrorMsg(ret);
-        }
+        // The kernel writes whole words, short frames are padded
+        std::vector<uint8_t> ret(std::max(length, 8), 0);
+        BitKernel::insert(ret.data(), BitKernel::locate(getStartBit(), getLength(), getByteOrder() != ByteOrder_LSB, length), _table->getRawValue(_row));
+        ret.resize(length);
 
         return ret;
     }
 
+    /**
+     * @brief Precomputes the location of the signal in frames of the given length, used by encodeInto().
+     * @param frameLength The data length of the parent message in bytes.
+     */
+    void CANSignal::locate(int frameLength)
+    {
+        _window = BitKernel::locate(getStartBit(), getLength(), getByteOrder() != ByteOrder_LSB, frameLength);
+    }
+
+    /**
+     * @brief Writes the raw value into a frame in place, leaving the bits of the other signals untouched.
+     * @param data Pointer to the frame, writable for at least max(frameLength, 8) bytes.
+     */
+    void CANSignal::encodeInto(uint8_t* data) const
+    {
+        refresh();
+        BitKernel::insert(data, _window, _table->getRawValue(_row));
+    }
+
 
     /**
      * @brief Adds an observer for the signal.
@@ -224,9 +492,14 @@ namespace cantools_cpp
      */
     void CANSignal::notifyObserver()
     {
+        if (_observers.empty() || !_message) {
+            return;
+        }
+
+        uint32_t messageId = _message->getId();
         for (auto observer : _observers)
         {
-            observer->updateSignal(getParent().lock()->getId(), getName());
+            observer->updateSignal(messageId, _position, _table->getName(_row));
         }
     }
 
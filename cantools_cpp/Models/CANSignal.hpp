@@ -8,8 +8,13 @@
 #pragma once
 #include <string>
 #include <memory>
+#include <memory_resource>
 #include <vector>
 #include "IBusObserver.hpp"
+#include "BitKernel.hpp"
+#include "Handles.hpp"
+#include "StringPool.hpp"
+#include "SignalTable.hpp"
 
 namespace cantools_cpp
 {
@@ -37,6 +42,16 @@ namespace cantools_cpp
         ByteOrder_LSB  ///< Least Significant Byte first (little-endian)
     };
 
+    /**
+     * @struct MultiplexerRange
+     * @brief Inclusive range of multiplexor values for which a multiplexed signal is present.
+     */
+    struct MultiplexerRange
+    {
+        uint64_t low;   ///< First multiplexor value of the range
+        uint64_t high;  ///< Last multiplexor value of the range
+    };
+
     /**
      * @class CANSignal
      * @brief Represents a signal within a CAN message. Handles signal decoding, value conversion, and observer notification.
@@ -48,7 +63,8 @@ namespace cantools_cpp
         void removeObserver(IBusObserver* observer);
 
         // Constructor
-        CANSignal(const std::string& name, uint8_t startBit, uint8_t length, float factor, float offset, float minVal, float maxVal, std::string unit, uint8_t byteOrder, uint8_t valType, std::string receiver, std::string multiplexer);
+        CANSignal(const std::string& name, uint8_t startBit, uint8_t length, float factor, float offset, float minVal, float maxVal, const std::string& unit, uint8_t byteOrder, uint8_t valType, const std::string& receiver, const std::string& multiplexer,
+            std::shared_ptr<StringPool> stringPool = nullptr, std::shared_ptr<SignalTable> table = nullptr, std::pmr::memory_resource* memory = nullptr);
 
         // Getters
         std::string getName() const;
@@ -63,9 +79,49 @@ namespace cantools_cpp
         uint8_t getByteOrder() const;
         float getMinVal() const;
         float getMaxVal() const;
-        std::string getUnit() const;
-        std::string getReceiver() const;
-        std::string getMultiplexer() const;
+        const std::string& getUnit() const;
+        const std::string& getReceiver() const;
+        const std::string& getMultiplexer() const;
+
+        /**
+         * @brief Indicates whether the signal is a multiplexor (switch) of its message ("M" or "mNM").
+         */
+        bool isMultiplexor() const;
+
+        /**
+         * @brief Indicates whether the signal is only present for some multiplexor values ("mN" or SG_MUL_VAL_).
+         */
+        bool isMultiplexed() const;
+
+        /**
+         * @brief Retrieves the name of the multiplexor this signal depends on.
+         *
+         * Empty until SG_MUL_VAL_ names it or the message resolves its multiplexing.
+         */
+        const std::string& getMultiplexorName() const;
+
+        /**
+         * @brief Retrieves the multiplexor signal this signal depends on, resolved by the parent message.
+         */
+        std::shared_ptr<CANSignal> getMultiplexorSignal() const;
+
+        /**
+         * @brief Retrieves the multiplexor values for which the signal is present.
+         */
+        const std::vector<MultiplexerRange>& getMultiplexerValues() const;
+
+        /**
+         * @brief Indicates whether the signal is present for the given multiplexor value.
+         * @param value The raw value of the multiplexor.
+         */
+        bool isMultiplexerValue(uint64_t value) const;
+
+        /**
+         * @brief Indicates whether the signal is present in the current message data.
+         *
+         * A multiplexed signal is active when its multiplexor is active and holds one of its multiplexer values.
+         */
+        bool isActive() const;
 
         // Setters
         void setName(const std::string& name);
@@ -77,36 +133,158 @@ namespace cantools_cpp
         void setPhysicalValue(double value);
         void setValueType(DbcValueType val);
 
+        /**
+         * @brief Sets the extended multiplexing of the signal (SG_MUL_VAL_), replacing the "mN" value.
+         * @param multiplexorName The name of the multiplexor.
+         * @param values The multiplexor values for which the signal is present.
+         */
+        void setMultiplexerValues(const std::string& multiplexorName, const std::vector<MultiplexerRange>& values);
+
+        /**
+         * @brief Sets the multiplexor signal this signal depends on.
+         * @param multiplexor The multiplexor signal, owned by the same message.
+         */
+        void setMultiplexorSignal(std::weak_ptr<CANSignal> multiplexor);
+
+        /**
+         * @brief Makes the signal decode itself on access from the data of a message in lazy decode mode.
+         * @param message The message holding the data, or nullptr to stop decoding on access.
+         * @param planIndex The index of the signal entry in the message's decode plan.
+         */
+        void setLazySource(const CANMessage* message, size_t planIndex);
+
+        /**
+         * @brief Registers interest in the signal, so that messages decoding selectively keep decoding it.
+         */
+        void subscribe();
+
+        /**
+         * @brief Withdraws an interest registered with subscribe().
+         */
+        void unsubscribe();
+
+        /**
+         * @brief Indicates whether the signal has at least one subscriber.
+         */
+        bool isSubscribed() const;
+
         // Display method
         void display() const;
 
         void setParent(std::weak_ptr<CANMessage> parent);
 
+        /**
+         * @brief Forgets the parent message, called by the message when it is destroyed.
+         * @param message The message being destroyed; the call is ignored if it is not the parent.
+         */
+        void releaseParent(const CANMessage* message);
+
+        /**
+         * @brief Moves the fields of the signal to a row of another table, e.g. the table of its bus.
+         * @param table The table receiving the signal.
+         */
+        void moveToTable(const std::shared_ptr<SignalTable>& table);
+
+        /**
+         * @brief Follows the row of the signal after SignalTable::appendRows() moved the rows of its table to another table.
+         * @param table The table the rows were moved to.
+         * @param offset The index in that table of the first moved row.
+         */
+        void followRows(const std::shared_ptr<SignalTable>& table, uint32_t offset);
+
+        /**
+         * @brief Retrieves the table holding the fields of the signal.
+         */
+        const std::shared_ptr<SignalTable>& getSignalTable() const { return _table; }
+
+        /**
+         * @brief Retrieves the row of the signal in its table.
+         */
+        uint32_t getRow() const { return _row; }
+
+        /**
+         * @brief Retrieves the position of the signal in its message, the signal part of its SignalHandle.
+         */
+        uint32_t getPosition() const { return _position; }
+
+        /**
+         * @brief Sets the position of the signal in its message, done by CANMessage::addSignal().
+         */
+        void setPosition(uint32_t position) { _position = position; }
+
         void decode(const uint8_t* data);
 
+        /**
+         * @brief Stores values decoded by the parent's DecodePlan and notifies the observers.
+         * @param rawValue The decoded raw value.
+         * @param physicalValue The decoded physical value.
+         */
+        void setDecodedValue(uint64_t rawValue, double physicalValue);
+
         std::vector<uint8_t> encode();
 
+        /**
+         * @brief Precomputes the location of the signal in frames of the given length, used by encodeInto().
+         * @param frameLength The data length of the parent message in bytes.
+         */
+        void locate(int frameLength);
+
+        /**
+         * @brief Writes the raw value into a frame in place, leaving the bits of the other signals untouched.
+         * @param data Pointer to the frame, writable for at least max(frameLength, 8) bytes.
+         */
+        void encodeInto(uint8_t* data) const;
+
+        /**
+         * @brief Converts a raw bit pattern into the physical value, according to the value type.
+         * @param rawValue The raw bit pattern of the signal.
+         * @return The physical value.
+         */
+        double rawToPhysical(uint64_t rawValue) const;
+
+        /**
+         * @brief Converts a physical value into the raw bit pattern, according to the value type.
+         *
+         * Integer values are rounded to the nearest raw value and saturated to the range of the signal;
+         * signed values are returned in two's complement over the signal length.
+         *
+         * @param physicalValue The physical value.
+         * @return The raw bit pattern of the signal.
+         */
+        uint64_t physicalToRaw(double physicalValue) const;
+
     private:
         void notifyObserver();
 
-        std::vector<IBusObserver*> _observers;
-
-        std::string _name;
-        uint16_t _startBit;
-        uint16_t _length;
-        float _factor;
-        float _offset;
-        uint64_t _rawValue;
-        double _physicalValue;
-        uint8_t _byteOrder;
-        float _minVal;
-        float _maxVal;
-        std::string _unit;
-        std::string _receiver;
-        std::string _multiplexer;
+        /**
+         * @brief Decodes the signal from its lazy source if the data changed since the last access.
+         */
+        void refresh() const;
 
-        std::weak_ptr<CANMessage> _parent;
+        /**
+         * @brief Returns the mask covering the bits of the signal.
+         */
+        uint64_t getRawMask() const;
 
-        DbcValueType _valueType;
+        std::pmr::vector<IBusObserver*> _observers;  ///< Observers, allocated in the arena of the bus when created by the parser
+
+        std::shared_ptr<StringPool> _stringPool;  ///< Pool holding the metadata strings
+        std::shared_ptr<SignalTable> _table;      ///< Table holding the layout, scaling, values and metadata of the signal
+        uint32_t _row;                            ///< Row of the signal in _table
+        uint32_t _position = InvalidHandle;       ///< Position of the signal in its message
+        bool _isMultiplexor;
+        const std::string* _multiplexorName;
+        std::vector<MultiplexerRange> _multiplexerValues;
+        std::weak_ptr<CANSignal> _multiplexorSignal;
+        const CANSignal* _multiplexor = nullptr;  ///< _multiplexorSignal without reference counting, for isActive()
+
+        const CANMessage* _lazySource = nullptr;  ///< Message decoding this signal on access, nullptr in eager mode
+        size_t _planIndex = 0;                     ///< Entry of the signal in the decode plan of _lazySource
+        mutable uint64_t _decodedEpoch = 0;        ///< Data epoch of _lazySource the values were decoded from
+        BitKernel::Window _window{};               ///< Location of the signal in the parent frame, set by locate()
+        uint32_t _subscriberCount = 0;             ///< Number of subscribe() calls not yet withdrawn
+
+        std::weak_ptr<CANMessage> _parent;
+        CANMessage* _message = nullptr;  ///< Parent message without reference counting, cleared by the message destructor
     };
 }
@@ -0,0 +1,133 @@
+/**
+ * @file CompiledDatabase.cpp
+ * @brief Implementation of the CompiledDatabase and DecoderState classes.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <algorithm>
+#include <map>
+#include "CompiledDatabase.hpp"
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+
+namespace cantools_cpp
+{
+    std::shared_ptr<const CompiledDatabase> CompiledDatabase::compile(const CANBus& bus)
+    {
+        std::shared_ptr<CompiledDatabase> database(new CompiledDatabase());
+        database->_name = bus.getName();
+
+        for (const auto& message : bus.getAllMessages()) {
+            const auto& signals = message->getSignals();
+
+            Message compiled{};
+            compiled.id = message->getId();
+            compiled.name = message->getName();
+            compiled.transmitter = message->getTransmitter();
+            compiled.length = message->getLength();
+            compiled.signalBegin = static_cast<uint32_t>(database->_signals.size());
+            compiled.signalCount = static_cast<uint32_t>(signals.size());
+
+            // Full plan of the message, whatever the decode mode and subscriptions of the live bus
+            compiled.plan.build(signals, compiled.length);
+            compiled.plan.detachSignals();
+
+            std::map<const CANSignal*, uint32_t> indexes;
+            for (const auto& signal : signals) {
+                indexes.emplace(signal.get(), static_cast<uint32_t>(database->_signals.size() + indexes.size()));
+            }
+
+            for (const auto& signal : signals) {
+                Signal definition{};
+                definition.name = signal->getName();
+                definition.unit = signal->getUnit();
+                definition.receiver = signal->getReceiver();
+                definition.message = static_cast<uint32_t>(database->_messages.size());
+                definition.startBit = signal->getStartBit();
+                definition.length = signal->getLength();
+                definition.byteOrder = signal->getByteOrder();
+                definition.valueType = signal->getValueType();
+                definition.factor = signal->getFactor();
+                definition.offset = signal->getOffset();
+                definition.minVal = signal->getMinVal();
+                definition.maxVal = signal->getMaxVal();
+                definition.isMultiplexor = signal->isMultiplexor();
+                definition.multiplexerValues = signal->getMultiplexerValues();
+
+                auto multiplexor = signal->isMultiplexed() ? signal->getMultiplexorSignal() : nullptr;
+                auto found = multiplexor ? indexes.find(multiplexor.get()) : indexes.end();
+                definition.multiplexor = found != indexes.end() ? found->second : NotFound;
+
+                database->_signals.push_back(std::move(definition));
+            }
+
+            database->_messageIndex.insert(compiled.id, static_cast<uint32_t>(database->_messages.size()));
+            database->_messages.push_back(std::move(compiled));
+        }
+
+        return database;
+    }
+
+    uint32_t CompiledDatabase::findMessage(const std::string& name) const
+    {
+        for (size_t i = 0; i < _messages.size(); ++i) {
+            if (_messages[i].name == name) {
+                return static_cast<uint32_t>(i);
+            }
+        }
+        return NotFound;
+    }
+
+    uint32_t CompiledDatabase::findSignal(uint32_t message, const std::string& name) const
+    {
+        if (message >= _messages.size()) {
+            return NotFound;
+        }
+
+        const Message& definition = _messages[message];
+        for (uint32_t i = definition.signalBegin; i < definition.signalBegin + definition.signalCount; ++i) {
+            if (_signals[i].name == name) {
+                return i;
+            }
+        }
+        return NotFound;
+    }
+
+    DecoderState::DecoderState(std::shared_ptr<const CompiledDatabase> database)
+        : _database(std::move(database))
+    {
+        size_t signalCount = _database->getSignalCount();
+        _rawValues.assign(signalCount, 0);
+        _physicalValues.resize(signalCount);
+        _present.assign(signalCount, 0);
+
+        // Values before the first frame, as for a freshly parsed signal
+        for (size_t i = 0; i < signalCount; ++i) {
+            _physicalValues[i] = _database->getSignal(static_cast<uint32_t>(i)).offset;
+        }
+    }
+
+    bool DecoderState::decode(uint32_t id, const uint8_t* data, int length)
+    {
+        uint32_t message = _database->findMessage(id);
+        if (message == CompiledDatabase::NotFound) {
+            return false;
+        }
+        decodeMessage(message, data, length);
+        return true;
+    }
+
+    void DecoderState::decodeMessage(uint32_t message, const uint8_t* data, int length)
+    {
+        const CompiledDatabase::Message& definition = _database->getMessage(message);
+
+        // The plan reads whole words: decode from a zero padded copy of the largest CAN FD payload
+        uint8_t frame[64] = {};
+        std::copy(data, data + std::min(std::max(length, 0), 64), frame);
+
+        uint8_t* present = _present.data() + definition.signalBegin;
+        std::fill(present, present + definition.signalCount, 0);
+        definition.plan.executeInto(frame, _rawValues.data() + definition.signalBegin, _physicalValues.data() + definition.signalBegin, present);
+    }
+}
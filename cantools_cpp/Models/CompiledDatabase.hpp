@@ -0,0 +1,192 @@
+/**
+ * @file CompiledDatabase.hpp
+ * @brief Declaration of the CompiledDatabase class, an immutable snapshot of the definitions of a built CAN bus.
+ *
+ * CANMessage and CANSignal mix the database definitions with the runtime state of one bus (data, current
+ * values, observers), so a loaded DBC cannot be decoded from several threads at once. A CompiledDatabase
+ * copies the definitions of a bus once CANBus::build() ran: messages, signals, multiplexing and the decode
+ * plan of each message, with no pointer back to the live objects. It is only handed out as a
+ * shared_ptr<const CompiledDatabase> and never changes afterwards, so any number of threads can share it
+ * without locks. Each decoder keeps its own values in a DecoderState created against it.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "DecodePlan.hpp"
+#include "MessageIndex.hpp"
+
+namespace cantools_cpp
+{
+    class CANBus;
+
+    class CompiledDatabase {
+    public:
+        static constexpr uint32_t NotFound = UINT32_MAX;  ///< Index returned for unknown messages and signals.
+
+        /**
+         * @brief Definition of a signal.
+         */
+        struct Signal {
+            std::string name;                                ///< Name of the signal.
+            std::string unit;                                ///< Unit of the physical value.
+            std::string receiver;                            ///< Receiving nodes.
+            uint32_t message;                                ///< Index of the message holding the signal.
+            uint16_t startBit;                               ///< Starting bit position.
+            uint16_t length;                                 ///< Length in bits.
+            uint8_t byteOrder;                               ///< Byte order.
+            DbcValueType valueType;                          ///< Interpretation of the raw value.
+            double factor;                                   ///< Scaling factor.
+            double offset;                                   ///< Offset applied after scaling.
+            float minVal;                                    ///< Minimum physical value.
+            float maxVal;                                    ///< Maximum physical value.
+            bool isMultiplexor;                              ///< Whether the signal is a multiplexor of its message.
+            uint32_t multiplexor;                            ///< Index of the multiplexor the signal depends on, NotFound if none.
+            std::vector<MultiplexerRange> multiplexerValues; ///< Multiplexor values for which the signal is present.
+        };
+
+        /**
+         * @brief Definition of a message and the plan decoding its signals.
+         */
+        struct Message {
+            uint32_t id;               ///< CAN identifier.
+            std::string name;          ///< Name of the message.
+            std::string transmitter;   ///< Transmitting node.
+            int length;                ///< Data length in bytes.
+            uint32_t signalBegin;      ///< Index of the first signal of the message.
+            uint32_t signalCount;      ///< Number of signals of the message, stored contiguously.
+            DecodePlan plan;           ///< Plan decoding all the signals, detached from the live signals.
+        };
+
+        /**
+         * @brief Compiles the definitions of a built bus.
+         *
+         * @param bus The bus, after CANBus::build().
+         * @return The compiled database; later changes to the bus do not affect it.
+         */
+        static std::shared_ptr<const CompiledDatabase> compile(const CANBus& bus);
+
+        /**
+         * @brief Retrieves the name of the bus the database was compiled from.
+         */
+        const std::string& getName() const { return _name; }
+
+        /**
+         * @brief Retrieves the number of messages.
+         */
+        size_t getMessageCount() const { return _messages.size(); }
+
+        /**
+         * @brief Retrieves the number of signals of all messages.
+         */
+        size_t getSignalCount() const { return _signals.size(); }
+
+        /**
+         * @brief Retrieves a message by index.
+         */
+        const Message& getMessage(uint32_t message) const { return _messages[message]; }
+
+        /**
+         * @brief Retrieves a signal by index.
+         */
+        const Signal& getSignal(uint32_t signal) const { return _signals[signal]; }
+
+        /**
+         * @brief Finds a message from its CAN identifier.
+         *
+         * @param id The CAN identifier.
+         * @return The index of the message, or NotFound.
+         */
+        uint32_t findMessage(uint32_t id) const { return _messageIndex.find(id); }
+
+        /**
+         * @brief Finds a message from its name.
+         *
+         * @param name The name of the message.
+         * @return The index of the message, or NotFound.
+         */
+        uint32_t findMessage(const std::string& name) const;
+
+        /**
+         * @brief Finds a signal of a message from its name.
+         *
+         * @param message The index of the message.
+         * @param name The name of the signal.
+         * @return The index of the signal in the database, or NotFound.
+         */
+        uint32_t findSignal(uint32_t message, const std::string& name) const;
+
+    private:
+        CompiledDatabase() = default;
+
+        std::string _name;               ///< Name of the compiled bus.
+        std::vector<Message> _messages;  ///< Messages, in the order of the bus.
+        std::vector<Signal> _signals;    ///< Signals of all messages, grouped by message.
+        MessageIndex _messageIndex;      ///< Index of each message by CAN identifier.
+    };
+
+    class DecoderState {
+    public:
+        /**
+         * @brief Creates the runtime state of one decoder over a compiled database.
+         *
+         * The state only holds the current values of the signals; the definitions are shared.
+         *
+         * @param database The compiled database.
+         */
+        explicit DecoderState(std::shared_ptr<const CompiledDatabase> database);
+
+        /**
+         * @brief Decodes a frame of the message with the given CAN identifier.
+         *
+         * @param id The CAN identifier of the frame.
+         * @param data Pointer to the frame payload.
+         * @param length Length of the payload; missing bytes read as 0.
+         * @return false if the database has no message with this identifier.
+         */
+        bool decode(uint32_t id, const uint8_t* data, int length);
+
+        /**
+         * @brief Decodes a frame of a message given by index.
+         *
+         * Signals that are not present for the multiplexor values of the frame keep their last values and are
+         * flagged as not present.
+         *
+         * @param message The index of the message in the database.
+         * @param data Pointer to the frame payload.
+         * @param length Length of the payload; missing bytes read as 0.
+         */
+        void decodeMessage(uint32_t message, const uint8_t* data, int length);
+
+        /**
+         * @brief Retrieves the raw value of a signal from the last frame of its message.
+         */
+        uint64_t getRawValue(uint32_t signal) const { return _rawValues[signal]; }
+
+        /**
+         * @brief Retrieves the physical value of a signal from the last frame of its message.
+         */
+        double getPhysicalValue(uint32_t signal) const { return _physicalValues[signal]; }
+
+        /**
+         * @brief Indicates whether a signal was present in the last frame of its message.
+         */
+        bool isPresent(uint32_t signal) const { return _present[signal] != 0; }
+
+        /**
+         * @brief Retrieves the database the state decodes.
+         */
+        const CompiledDatabase& getDatabase() const { return *_database; }
+
+    private:
+        std::shared_ptr<const CompiledDatabase> _database;  ///< Shared definitions.
+        std::vector<uint64_t> _rawValues;                    ///< Raw value of each signal of the database.
+        std::vector<double> _physicalValues;                 ///< Physical value of each signal of the database.
+        std::vector<uint8_t> _present;                       ///< Whether each signal was present in the last frame of its message.
+    };
+}
@@ -0,0 +1,336 @@
+/**
+ * @file DecodePlan.cpp
+ * @brief Implementation of the DecodePlan class used by CANMessage to decode frames without allocations.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <algorithm>
+#include "DecodePlan.hpp"
+#include "CANSignal.hpp"
+
+namespace cantools_cpp
+{
+    namespace
+    {
+        /**
+         * @brief Pushes decoded values to the signals of the plan entries.
+         */
+        struct SignalSink {
+            void operator()(const DecodePlan::Entry& entry, uint64_t rawValue, double physicalValue) const {
+                entry.signal->setDecodedValue(rawValue, physicalValue);
+            }
+        };
+
+        /**
+         * @brief Stores decoded values into arrays indexed by the slots of the plan entries.
+         */
+        struct SlotSink {
+            uint64_t* rawValues;
+            double* physicalValues;
+            uint8_t* present;
+
+            void operator()(const DecodePlan::Entry& entry, uint64_t rawValue, double physicalValue) const {
+                rawValues[entry.slot] = rawValue;
+                physicalValues[entry.slot] = physicalValue;
+                present[entry.slot] = 1;
+            }
+        };
+    }
+
+    /**
+     * @brief Computes the plan entry of a single signal.
+     *
+     * @param signal The signal to lay out.
+     * @param frameLength The data length of the message in bytes.
+     * @return The precomputed entry.
+     */
+    DecodePlan::Entry DecodePlan::makeEntry(CANSignal& signal, int frameLength)
+    {
+        Entry entry{};
+        entry.window = BitKernel::locate(signal.getStartBit(), signal.getLength(), signal.getByteOrder() != ByteOrder_LSB, frameLength);
+        entry.valueType = signal.getValueType();
+        entry.signBit = entry.valueType == Signed ? entry.window.mask ^ (entry.window.mask >> 1) : 0;
+        entry.factor = signal.getFactor();
+        entry.offset = signal.getOffset();
+        entry.signal = &signal;
+        return entry;
+    }
+
+    /**
+     * @brief Builds the plan for the given signals of a frame of the given length.
+     *
+     * Signals whose multiplexor has been resolved are moved to the branches of that multiplexor,
+     * all the other ones go to the root block.
+     *
+     * @param signals The signals of the message, in decode order.
+     * @param frameLength The data length of the message in bytes.
+     */
+    void DecodePlan::build(const std::vector<std::shared_ptr<CANSignal>>& signals, int frameLength)
+    {
+        _entries.clear();
+        _blocks.clear();
+        _blockChildren.clear();
+        _muxGroups.clear();
+        _muxTable.clear();
+        _muxRanges.clear();
+
+        MultiplexedMap multiplexed;
+        std::vector<CANSignal*> root;
+        for (const auto& signal : signals) {
+            auto multiplexor = signal->isMultiplexed() ? signal->getMultiplexorSignal() : nullptr;
+            if (multiplexor) {
+                multiplexed[multiplexor.get()].push_back(signal.get());
+            }
+            else {
+                root.push_back(signal.get());
+            }
+        }
+
+        GroupMap groups;
+        buildBlock(root, frameLength, multiplexed, groups);
+
+        std::map<const CANSignal*, uint32_t> slots;
+        for (size_t i = 0; i < signals.size(); ++i) {
+            slots.emplace(signals[i].get(), static_cast<uint32_t>(i));
+        }
+        for (Entry& entry : _entries) {
+            entry.slot = slots[entry.signal];
+        }
+
+        _built = true;
+    }
+
+    uint32_t DecodePlan::buildBlock(const std::vector<CANSignal*>& signals, int frameLength, const MultiplexedMap& multiplexed, GroupMap& groups)
+    {
+        uint32_t index = static_cast<uint32_t>(_blocks.size());
+        Block block{};
+        block.begin = _entries.size();
+
+        // Group the entries by value type, keeping the signal order inside each group
+        for (int type = 0; type < ValueTypeCount; ++type) {
+            for (CANSignal* signal : signals) {
+                if (signal->getValueType() == type) {
+                    _entries.push_back(makeEntry(*signal, frameLength));
+                }
+            }
+            block.groupEnd[type] = _entries.size();
+        }
+
+        std::vector<CANSignal*> multiplexors;
+        for (CANSignal* signal : signals) {
+            if (multiplexed.count(signal)) {
+                multiplexors.push_back(signal);
+            }
+        }
+
+        // Reserve the children first, the branches append their own blocks and children behind
+        block.childBegin = static_cast<uint32_t>(_blockChildren.size());
+        block.childEnd = block.childBegin + static_cast<uint32_t>(multiplexors.size());
+        _blockChildren.resize(block.childEnd);
+        _blocks.push_back(block);
+
+        for (size_t i = 0; i < multiplexors.size(); ++i) {
+            uint32_t group = buildGroup(multiplexors[i], frameLength, multiplexed, groups);
+            _blockChildren[block.childBegin + i] = group;
+        }
+
+        return index;
+    }
+
+    uint32_t DecodePlan::buildGroup(CANSignal* multiplexor, int frameLength, const MultiplexedMap& multiplexed, GroupMap& groups)
+    {
+        auto found = groups.find(multiplexor);
+        if (found != groups.end()) {
+            return found->second;
+        }
+
+        uint32_t index = static_cast<uint32_t>(_muxGroups.size());
+        groups[multiplexor] = index;
+        _muxGroups.push_back(MuxGroup{});
+
+        // Split the multiplexor values into intervals where the same signals are present
+        const std::vector<CANSignal*>& signals = multiplexed.at(multiplexor);
+        std::vector<uint64_t> bounds;
+        for (CANSignal* signal : signals) {
+            for (const MultiplexerRange& range : signal->getMultiplexerValues()) {
+                bounds.push_back(range.low);
+                if (range.high != UINT64_MAX) {
+                    bounds.push_back(range.high + 1);
+                }
+            }
+        }
+        std::sort(bounds.begin(), bounds.end());
+        bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+        std::map<std::vector<CANSignal*>, uint32_t> branches;
+        std::vector<MuxRange> ranges;
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            uint64_t low = bounds[i];
+            uint64_t high = i + 1 < bounds.size() ? bounds[i + 1] - 1 : UINT64_MAX;
+
+            std::vector<CANSignal*> present;
+            for (CANSignal* signal : signals) {
+                if (signal->isMultiplexerValue(low)) {
+                    present.push_back(signal);
+                }
+            }
+            if (present.empty()) {
+                continue;
+            }
+
+            // Values sharing the same signals share the same block
+            auto branch = branches.find(present);
+            uint32_t block = branch != branches.end() ? branch->second : buildBlock(present, frameLength, multiplexed, groups);
+            branches.emplace(present, block);
+
+            if (!ranges.empty() && ranges.back().block == block && ranges.back().high + 1 == low) {
+                ranges.back().high = high;
+            }
+            else {
+                ranges.push_back({ low, high, block });
+            }
+        }
+
+        MuxGroup& group = _muxGroups[index];
+        group.window = makeEntry(*multiplexor, frameLength).window;
+        group.rangeBegin = _muxRanges.size();
+        _muxRanges.insert(_muxRanges.end(), ranges.begin(), ranges.end());
+        group.rangeEnd = _muxRanges.size();
+
+        if (!ranges.empty() && ranges.back().high < DenseTableLimit) {
+            group.tableBegin = _muxTable.size();
+            group.tableSize = static_cast<size_t>(ranges.back().high) + 1;
+            _muxTable.resize(group.tableBegin + group.tableSize, NoBlock);
+            for (const MuxRange& range : ranges) {
+                std::fill(_muxTable.begin() + group.tableBegin + range.low, _muxTable.begin() + group.tableBegin + range.high + 1, range.block);
+            }
+        }
+
+        return index;
+    }
+
+    /**
+     * @brief Finds the entry of a signal.
+     *
+     * @param signal The signal to look for.
+     * @return The index of the first entry of the signal, getEntryCount() if the signal is not planned.
+     */
+    size_t DecodePlan::findEntry(const CANSignal* signal) const
+    {
+        for (size_t i = 0; i < _entries.size(); ++i) {
+            if (_entries[i].signal == signal) {
+                return i;
+            }
+        }
+        return _entries.size();
+    }
+
+    template <DbcValueType Type, bool OnlyChanged, typename Sink>
+    void DecodePlan::executeGroup(const uint8_t* data, const uint8_t* diff, size_t begin, size_t end, const Sink& sink) const
+    {
+        for (size_t i = begin; i < end; ++i) {
+            const Entry& entry = _entries[i];
+            if (OnlyChanged && BitKernel::extract(diff, entry.window) == 0) {
+                continue;
+            }
+            uint64_t rawValue = BitKernel::extract(data, entry.window);
+            sink(entry, rawValue, toPhysical<Type>(entry, rawValue));
+        }
+    }
+
+    uint32_t DecodePlan::lookup(const MuxGroup& group, uint64_t value) const
+    {
+        if (group.tableSize) {
+            return value < group.tableSize ? _muxTable[group.tableBegin + value] : NoBlock;
+        }
+
+        auto first = _muxRanges.begin() + group.rangeBegin;
+        auto last = _muxRanges.begin() + group.rangeEnd;
+        auto range = std::upper_bound(first, last, value, [](uint64_t v, const MuxRange& r) { return v < r.low; });
+        if (range == first || value > (range - 1)->high) {
+            return NoBlock;
+        }
+        return (range - 1)->block;
+    }
+
+    template <bool OnlyChanged, typename Sink>
+    void DecodePlan::executeBlock(const uint8_t* data, const uint8_t* diff, uint32_t index, const Sink& sink) const
+    {
+        const Block& block = _blocks[index];
+        executeGroup<Signed, OnlyChanged>(data, diff, block.begin, block.groupEnd[Signed], sink);
+        executeGroup<Unsigned, OnlyChanged>(data, diff, block.groupEnd[Signed], block.groupEnd[Unsigned], sink);
+        executeGroup<IEEEFloat, OnlyChanged>(data, diff, block.groupEnd[Unsigned], block.groupEnd[IEEEFloat], sink);
+        executeGroup<IEEEDouble, OnlyChanged>(data, diff, block.groupEnd[IEEEFloat], block.groupEnd[IEEEDouble], sink);
+
+        for (uint32_t child = block.childBegin; child < block.childEnd; ++child) {
+            const MuxGroup& group = _muxGroups[_blockChildren[child]];
+            uint64_t value = BitKernel::extract(data, group.window);
+            uint32_t branch = lookup(group, value);
+            if (branch == NoBlock) {
+                continue;
+            }
+
+            // A branch entered from another one holds stale values, all of its signals are decoded
+            if (OnlyChanged && lookup(group, value ^ BitKernel::extract(diff, group.window)) == branch) {
+                executeBlock<true>(data, diff, branch, sink);
+            }
+            else {
+                executeBlock<false>(data, diff, branch, sink);
+            }
+        }
+    }
+
+    /**
+     * @brief Decodes all planned signals from the frame and pushes the values to the signals.
+     *
+     * Only the signals present for the current multiplexor values are decoded, the other ones keep their last values.
+     *
+     * @param data Pointer to the frame payload, readable for at least max(frameLength, 8) bytes.
+     */
+    void DecodePlan::execute(const uint8_t* data) const
+    {
+        if (!_blocks.empty()) {
+            executeBlock<false>(data, nullptr, 0, SignalSink{});
+        }
+    }
+
+    /**
+     * @brief Decodes only the planned signals whose bits changed, and pushes their values to the signals.
+     *
+     * @param data Pointer to the new frame payload, readable for at least max(frameLength, 8) bytes.
+     * @param diff XOR of the new and previous frame payloads, readable for as many bytes.
+     */
+    void DecodePlan::executeChanged(const uint8_t* data, const uint8_t* diff) const
+    {
+        if (!_blocks.empty()) {
+            executeBlock<true>(data, diff, 0, SignalSink{});
+        }
+    }
+
+    /**
+     * @brief Decodes all planned signals from the frame into caller provided arrays, leaving the signals untouched.
+     *
+     * @param data Pointer to the frame payload, readable for at least max(frameLength, 8) bytes.
+     * @param rawValues Raw value of each signal of the message.
+     * @param physicalValues Physical value of each signal of the message.
+     * @param present Set to 1 for each decoded signal.
+     */
+    void DecodePlan::executeInto(const uint8_t* data, uint64_t* rawValues, double* physicalValues, uint8_t* present) const
+    {
+        if (!_blocks.empty()) {
+            executeBlock<false>(data, nullptr, 0, SlotSink{ rawValues, physicalValues, present });
+        }
+    }
+
+    /**
+     * @brief Drops the pointers from the entries to the signals, so that the plan no longer refers to any CANSignal.
+     */
+    void DecodePlan::detachSignals()
+    {
+        for (Entry& entry : _entries) {
+            entry.signal = nullptr;
+        }
+    }
+}
@@ -0,0 +1,238 @@
+/**
+ * @file DecodePlan.hpp
+ * @brief Declaration of the DecodePlan class, a precompiled per-message table used to decode all signals of a frame.
+ *
+ * A DecodePlan is built once per CANMessage after CANBus::build(). It flattens the signal layout
+ * (word offset, shift, mask, scaling) into a contiguous array so that decoding a frame is a tight
+ * loop over plain data, without locking parents, copying or reversing the payload. Entries are grouped
+ * by value type when the plan is built, so each group runs without any per-signal type switch.
+ *
+ * Multiplexed messages are split into blocks: the root block holds the signals that are always present,
+ * and every multiplexor owns a jump table from its value to the block of the signals present for that
+ * value. Decoding a frame reads each multiplexor first and only decodes the active branches.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+#include "BitKernel.hpp"
+#include "CANSignal.hpp"
+
+namespace cantools_cpp
+{
+    class CANSignal;
+
+    class DecodePlan {
+    public:
+        /**
+         * @brief Precomputed layout of one signal inside a frame of a fixed length.
+         */
+        struct Entry {
+            BitKernel::Window window;  ///< Location of the signal bits in the frame.
+            uint64_t signBit;          ///< Sign bit of signed signals, 0 otherwise.
+            double factor;             ///< Scaling factor applied to the raw value.
+            double offset;             ///< Offset applied after scaling.
+            CANSignal* signal;         ///< Signal receiving the decoded values (owned by the message), nullptr once detached.
+            uint32_t slot;             ///< Position of the signal in the message, index of its value in executeInto() outputs.
+            DbcValueType valueType;    ///< Interpretation of the raw value.
+        };
+
+        /**
+         * @brief Converts a raw value into its physical value.
+         *
+         * The value type is a template parameter so that plan loops are specialized per type.
+         *
+         * @param entry The plan entry of the signal.
+         * @param raw The raw bit pattern of the signal.
+         * @return The physical value.
+         */
+        template <DbcValueType Type>
+        static inline double toPhysical(const Entry& entry, uint64_t raw) {
+            double value;
+            if constexpr (Type == Unsigned) {
+                value = static_cast<double>(raw);
+            }
+            else if constexpr (Type == Signed) {
+                value = static_cast<double>(BitKernel::signExtend(raw, entry.signBit));
+            }
+            else if constexpr (Type == IEEEFloat) {
+                value = BitKernel::toFloat(raw);
+            }
+            else {
+                value = BitKernel::toDouble(raw);
+            }
+            return value * entry.factor + entry.offset;
+        }
+
+        /**
+         * @brief Builds the plan for the given signals of a frame of the given length.
+         *
+         * @param signals The signals of the message, in decode order.
+         * @param frameLength The data length of the message in bytes.
+         */
+        void build(const std::vector<std::shared_ptr<CANSignal>>& signals, int frameLength);
+
+        /**
+         * @brief Decodes all planned signals from the frame and pushes the values to the signals.
+         *
+         * Multiplexed signals are only decoded when present, the other ones keep their last values.
+         *
+         * @param data Pointer to the frame payload, readable for at least max(frameLength, 8) bytes.
+         */
+        void execute(const uint8_t* data) const;
+
+        /**
+         * @brief Decodes only the planned signals whose bits changed, and pushes their values to the signals.
+         *
+         * Each entry's window is applied to the XOR of the new and previous frames, so a signal is only
+         * decoded when one of its own bits changed. When a multiplexor jumps to another branch, the
+         * signals of the new branch are all decoded.
+         *
+         * @param data Pointer to the new frame payload, readable for at least max(frameLength, 8) bytes.
+         * @param diff XOR of the new and previous frame payloads, readable for as many bytes.
+         */
+        void executeChanged(const uint8_t* data, const uint8_t* diff) const;
+
+        /**
+         * @brief Decodes all planned signals from the frame into caller provided arrays, leaving the signals untouched.
+         *
+         * Values are stored at the slot of each entry, the position of the signal in the message. Only the
+         * signals present for the current multiplexor values are written and flagged in present; the caller
+         * clears the flags beforehand. The plan is only read, so several threads may run it concurrently.
+         *
+         * @param data Pointer to the frame payload, readable for at least max(frameLength, 8) bytes.
+         * @param rawValues Raw value of each signal of the message.
+         * @param physicalValues Physical value of each signal of the message.
+         * @param present Set to 1 for each decoded signal.
+         */
+        void executeInto(const uint8_t* data, uint64_t* rawValues, double* physicalValues, uint8_t* present) const;
+
+        /**
+         * @brief Drops the pointers from the entries to the signals, so that the plan no longer refers to any CANSignal.
+         *
+         * Only executeInto() may run a detached plan.
+         */
+        void detachSignals();
+
+        /**
+         * @brief Computes the plan entry of a single signal.
+         *
+         * @param signal The signal to lay out.
+         * @param frameLength The data length of the message in bytes.
+         * @return The precomputed entry.
+         */
+        static Entry makeEntry(CANSignal& signal, int frameLength);
+
+        /**
+         * @brief Indicates whether the plan has been built.
+         *
+         * @return true if build() has been called at least once.
+         */
+        bool isBuilt() const { return _built; }
+
+        /**
+         * @brief Retrieves a planned entry.
+         *
+         * @param index The index of the entry.
+         * @return The entry.
+         */
+        const Entry& getEntry(size_t index) const { return _entries[index]; }
+
+        /**
+         * @brief Finds the entry of a signal.
+         *
+         * @param signal The signal to look for.
+         * @return The index of the first entry of the signal, getEntryCount() if the signal is not planned.
+         */
+        size_t findEntry(const CANSignal* signal) const;
+
+        /**
+         * @brief Retrieves the number of planned entries.
+         *
+         * @return The number of entries.
+         */
+        size_t getEntryCount() const { return _entries.size(); }
+
+    private:
+        static constexpr int ValueTypeCount = 4;  ///< Number of DbcValueType values.
+        static constexpr uint32_t NoBlock = UINT32_MAX;  ///< Jump target of multiplexor values without signals.
+        static constexpr uint64_t DenseTableLimit = 1024;  ///< Largest multiplexor value range using a dense jump table.
+
+        /**
+         * @brief Contiguous entries decoded together, followed by the multiplexors they contain.
+         */
+        struct Block {
+            size_t begin;                           ///< First entry of the block.
+            size_t groupEnd[ValueTypeCount];        ///< End of each value type group, in DbcValueType order.
+            uint32_t childBegin;                    ///< First multiplexor of the block in _blockChildren.
+            uint32_t childEnd;                      ///< End of the multiplexors of the block in _blockChildren.
+        };
+
+        /**
+         * @brief Multiplexor values [low, high] jumping to the same block.
+         */
+        struct MuxRange {
+            uint64_t low;   ///< First value of the range.
+            uint64_t high;  ///< Last value of the range.
+            uint32_t block; ///< Block decoded for these values.
+        };
+
+        /**
+         * @brief A multiplexor and the jump table to the blocks of its multiplexed signals.
+         *
+         * Small value ranges use a dense table indexed by the multiplexor value, larger ones a sorted
+         * list of ranges searched by bisection.
+         */
+        struct MuxGroup {
+            BitKernel::Window window;  ///< Location of the multiplexor in the frame.
+            size_t tableBegin;         ///< First slot of the dense table in _muxTable.
+            size_t tableSize;          ///< Number of slots of the dense table, 0 when ranges are used.
+            size_t rangeBegin;         ///< First range in _muxRanges.
+            size_t rangeEnd;           ///< End of the ranges in _muxRanges.
+        };
+
+        /**
+         * @brief Decodes the entries of one value type group, or only the changed ones, and hands the values to the sink.
+         */
+        template <DbcValueType Type, bool OnlyChanged, typename Sink>
+        void executeGroup(const uint8_t* data, const uint8_t* diff, size_t begin, size_t end, const Sink& sink) const;
+
+        /**
+         * @brief Decodes a block, then the active branch of each of its multiplexors.
+         */
+        template <bool OnlyChanged, typename Sink>
+        void executeBlock(const uint8_t* data, const uint8_t* diff, uint32_t block, const Sink& sink) const;
+
+        /**
+         * @brief Finds the block of a multiplexor value.
+         */
+        uint32_t lookup(const MuxGroup& group, uint64_t value) const;
+
+        using MultiplexedMap = std::map<const CANSignal*, std::vector<CANSignal*>>;  ///< Multiplexed signals by multiplexor.
+        using GroupMap = std::map<const CANSignal*, uint32_t>;  ///< Group index by multiplexor.
+
+        /**
+         * @brief Appends a block for the given signals and the multiplexor groups it contains.
+         */
+        uint32_t buildBlock(const std::vector<CANSignal*>& signals, int frameLength, const MultiplexedMap& multiplexed, GroupMap& groups);
+
+        /**
+         * @brief Appends the multiplexor group of a signal and the blocks of its branches.
+         */
+        uint32_t buildGroup(CANSignal* multiplexor, int frameLength, const MultiplexedMap& multiplexed, GroupMap& groups);
+
+        std::vector<Entry> _entries;            ///< Flat array of signal entries, grouped by block then by value type.
+        std::vector<Block> _blocks;             ///< Blocks of entries, the root block first.
+        std::vector<uint32_t> _blockChildren;   ///< Multiplexor groups of each block.
+        std::vector<MuxGroup> _muxGroups;       ///< Multiplexors of the message.
+        std::vector<uint32_t> _muxTable;        ///< Dense jump tables of the multiplexor groups.
+        std::vector<MuxRange> _muxRanges;       ///< Sorted jump ranges of the multiplexor groups.
+        bool _built = false;                    ///< Set once the plan has been built.
+    };
+}
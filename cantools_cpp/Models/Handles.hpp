@@ -0,0 +1,57 @@
+/**
+ * @file Handles.hpp
+ * @brief Stable integer handles to buses, messages and signals, resolved once from their names.
+ *
+ * Handles are plain positions: a bus in the order it was created by the CANBusManager, a message in
+ * the order it was added to its bus, and a signal in the order it was attached to its message. They
+ * stay valid for the lifetime of the loaded database, so steady-state code can read, write and
+ * subscribe through CANBusManager without hashing or comparing any name.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace cantools_cpp
+{
+    constexpr uint32_t InvalidHandle = UINT32_MAX;  ///< Position of handles that could not be resolved.
+
+    /**
+     * @struct BusHandle
+     * @brief Handle to a CAN bus of a CANBusManager.
+     */
+    struct BusHandle
+    {
+        uint32_t bus = InvalidHandle;  ///< Position of the bus in the manager.
+
+        bool isValid() const { return bus != InvalidHandle; }
+    };
+
+    /**
+     * @struct MessageHandle
+     * @brief Handle to a message of a CAN bus.
+     */
+    struct MessageHandle
+    {
+        uint32_t bus = InvalidHandle;      ///< Position of the bus in the manager.
+        uint32_t message = InvalidHandle;  ///< Position of the message on the bus.
+
+        bool isValid() const { return message != InvalidHandle; }
+    };
+
+    /**
+     * @struct SignalHandle
+     * @brief Handle to a signal of a message.
+     */
+    struct SignalHandle
+    {
+        uint32_t bus = InvalidHandle;      ///< Position of the bus in the manager.
+        uint32_t message = InvalidHandle;  ///< Position of the message on the bus.
+        uint32_t signal = InvalidHandle;   ///< Position of the signal in the message.
+
+        bool isValid() const { return signal != InvalidHandle; }
+    };
+}
@@ -8,13 +8,30 @@
 
 #pragma once
 #include <string>
+#include "Handles.hpp"
 
 namespace cantools_cpp
 {
 	class IBusManagerObserver
 	{
 	public:
-		virtual void updateMessage(std::string busName, uint32_t messageId) = 0;
-		virtual void updateSignal(std::string busName, uint32_t messageId, std::string signalName) = 0;
+		virtual void updateMessage(const std::string& busName, uint32_t messageId) = 0;
+		virtual void updateSignal(const std::string& busName, uint32_t messageId, const std::string& signalName) = 0;
+
+		/**
+		 * @brief Called when a signal changes, with the handle of the signal.
+		 *
+		 * Observers working with handles override it to identify the signal without comparing names;
+		 * by default it forwards to the name based overload.
+		 *
+		 * @param signal The handle of the signal, invalid if the bus does not belong to a CANBusManager.
+		 * @param busName The name of the bus.
+		 * @param messageId The ID of the message holding the signal.
+		 * @param signalName The name of the signal.
+		 */
+		virtual void updateSignal(SignalHandle /*signal*/, const std::string& busName, uint32_t messageId, const std::string& signalName)
+		{
+			updateSignal(busName, messageId, signalName);
+		}
 	};
 }
\ No newline at end of file
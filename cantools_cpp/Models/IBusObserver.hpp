@@ -15,6 +15,25 @@ namespace cantools_cpp
 	{
 	public:
 		virtual void updateMessage(uint32_t messageId) = 0;
-		virtual void updateSignal(uint32_t messageId, std::string signalName) = 0;
+		virtual void updateSignal(uint32_t messageId, const std::string& signalName) = 0;
+
+		/**
+		 * @brief Called when the ID of an observed message changes.
+		 *
+		 * @param oldId The previous ID of the message.
+		 * @param newId The new ID of the message.
+		 */
+		virtual void updateMessageId(uint32_t /*oldId*/, uint32_t /*newId*/) {}
+
+		/**
+		 * @brief Called when an observed signal changes, with its position in its message.
+		 *
+		 * Forwards to the name based overload unless overridden.
+		 *
+		 * @param messageId The ID of the message holding the signal.
+		 * @param signalPosition The position of the signal in the message.
+		 * @param signalName The name of the signal.
+		 */
+		virtual void updateSignal(uint32_t messageId, uint32_t /*signalPosition*/, const std::string& signalName) { updateSignal(messageId, signalName); }
 	};
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+/**
+ * @file MessageIndex.cpp
+ * @brief Implementation of the MessageIndex class: insertion, removal and growth of the ID tables.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <algorithm>
+#include "MessageIndex.hpp"
+
+namespace cantools_cpp
+{
+    MessageIndex::MessageIndex()
+        : _standard(StandardIdCount, NotFound), _extendedUsed(0), _count(0) {}
+
+    void MessageIndex::insert(uint32_t id, uint32_t position) {
+        if (id < StandardIdCount) {
+            _count += _standard[id] == NotFound;
+            _standard[id] = position;
+            return;
+        }
+
+        // Keep the table at most half full, erased slots included, so that probes stay short
+        if (2 * (_extendedUsed + 1) > _extended.size()) {
+            rehash(std::max(MinExtendedSlots, 4 * (_count + 1)));
+        }
+
+        // Probe until the ID or an empty slot, reusing the first erased slot met on the way
+        size_t mask = _extended.size() - 1;
+        size_t target = _extended.size();
+        for (size_t slot = hash(id) & mask; ; slot = (slot + 1) & mask) {
+            Slot& entry = _extended[slot];
+            if (entry.position == Empty) {
+                if (target == _extended.size()) {
+                    target = slot;
+                    ++_extendedUsed;
+                }
+                break;
+            }
+            if (entry.position == Erased) {
+                if (target == _extended.size()) {
+                    target = slot;
+                }
+                continue;
+            }
+            if (entry.id == id) {
+                entry.position = position;
+                return;
+            }
+        }
+
+        _extended[target] = { id, position };
+        ++_count;
+    }
+
+    void MessageIndex::erase(uint32_t id) {
+        if (id < StandardIdCount) {
+            _count -= _standard[id] != NotFound;
+            _standard[id] = NotFound;
+            return;
+        }
+        if (_extended.empty()) {
+            return;
+        }
+
+        size_t mask = _extended.size() - 1;
+        for (size_t slot = hash(id) & mask; ; slot = (slot + 1) & mask) {
+            Slot& entry = _extended[slot];
+            if (entry.position == Empty) {
+                return;
+            }
+            if (entry.id == id && entry.position != Erased) {
+                entry.position = Erased;
+                --_count;
+                return;
+            }
+        }
+    }
+
+    void MessageIndex::clear() {
+        std::fill(_standard.begin(), _standard.end(), NotFound);
+        _extended.clear();
+        _extendedUsed = 0;
+        _count = 0;
+    }
+
+    void MessageIndex::rehash(size_t slotCount) {
+        size_t size = MinExtendedSlots;
+        while (size < slotCount) {
+            size *= 2;
+        }
+
+        std::vector<Slot> previous(size, Slot{ 0, Empty });
+        previous.swap(_extended);
+        _extendedUsed = 0;
+
+        size_t mask = _extended.size() - 1;
+        for (const Slot& entry : previous) {
+            if (entry.position == Empty || entry.position == Erased) {
+                continue;
+            }
+            size_t slot = hash(entry.id) & mask;
+            while (_extended[slot].position != Empty) {
+                slot = (slot + 1) & mask;
+            }
+            _extended[slot] = entry;
+            ++_extendedUsed;
+        }
+    }
+}
@@ -0,0 +1,114 @@
+/**
+ * @file MessageIndex.hpp
+ * @brief Declaration of the MessageIndex class, the constant time message ID lookup table of a CANBus.
+ *
+ * Standard 11 bit identifiers index a dense direct-mapped table of 2048 slots. All the other identifiers
+ * (29 bit extended ones, with or without the DBC extended flag in bit 31) go to an open-addressing hash
+ * table with linear probing, kept at most half full.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cantools_cpp
+{
+    class MessageIndex {
+    public:
+        static constexpr uint32_t NotFound = UINT32_MAX;  ///< Position returned for unknown IDs.
+
+        /**
+         * @brief Constructs an empty index.
+         */
+        MessageIndex();
+
+        /**
+         * @brief Finds the position of a message.
+         *
+         * @param id The ID of the message.
+         * @return The position stored for the ID, or NotFound.
+         */
+        uint32_t find(uint32_t id) const {
+            if (id < StandardIdCount) {
+                return _standard[id];
+            }
+            if (_extended.empty()) {
+                return NotFound;
+            }
+
+            size_t mask = _extended.size() - 1;
+            for (size_t slot = hash(id) & mask; ; slot = (slot + 1) & mask) {
+                const Slot& entry = _extended[slot];
+                if (entry.position == Empty) {
+                    return NotFound;
+                }
+                if (entry.id == id && entry.position != Erased) {
+                    return entry.position;
+                }
+            }
+        }
+
+        /**
+         * @brief Stores the position of a message, replacing the one already stored for the ID.
+         *
+         * @param id The ID of the message.
+         * @param position The position of the message, below NotFound - 1.
+         */
+        void insert(uint32_t id, uint32_t position);
+
+        /**
+         * @brief Removes an ID from the index.
+         *
+         * @param id The ID of the message.
+         */
+        void erase(uint32_t id);
+
+        /**
+         * @brief Removes all IDs from the index.
+         */
+        void clear();
+
+        /**
+         * @brief Retrieves the number of indexed IDs.
+         *
+         * @return The number of IDs.
+         */
+        size_t size() const { return _count; }
+
+    private:
+        static constexpr uint32_t StandardIdCount = 2048;  ///< Number of 11 bit identifiers.
+        static constexpr uint32_t Empty = NotFound;         ///< Position of a hash slot never used.
+        static constexpr uint32_t Erased = NotFound - 1;    ///< Position of a hash slot whose ID was erased.
+        static constexpr size_t MinExtendedSlots = 16;      ///< Initial size of the hash table.
+
+        /**
+         * @brief Slot of the extended ID hash table.
+         */
+        struct Slot {
+            uint32_t id;        ///< ID stored in the slot.
+            uint32_t position;  ///< Position of the message, Empty or Erased for free slots.
+        };
+
+        /**
+         * @brief Fibonacci hash of an ID, spreading consecutive IDs over the table.
+         */
+        static size_t hash(uint32_t id) {
+            return static_cast<size_t>((static_cast<uint64_t>(id) * 0x9E3779B97F4A7C15ULL) >> 32);
+        }
+
+        /**
+         * @brief Rebuilds the hash table with the given number of slots, dropping erased slots.
+         */
+        void rehash(size_t slotCount);
+
+        std::vector<uint32_t> _standard;  ///< Positions of the standard IDs, NotFound when unused.
+        std::vector<Slot> _extended;      ///< Hash table of the other IDs, its size is a power of two.
+        size_t _extendedUsed;             ///< Number of hash slots that are not Empty, erased ones included.
+        size_t _count;                    ///< Number of indexed IDs.
+    };
+}
@@ -0,0 +1,94 @@
+/**
+ * @file ObjectView.hpp
+ * @brief Declaration of the ObjectView class template, a read-only range over the objects of a database.
+ *
+ * Buses, messages, signals and nodes are owned through vectors of shared pointers. An ObjectView walks
+ * such a vector in place and yields references to the objects, so iterating the database neither copies
+ * a container nor touches a reference count. A view over const objects only gives const access.
+ *
+ * A view is invalidated like an iterator of the underlying vector, e.g. when an object is added.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace cantools_cpp
+{
+    template <typename T>
+    class ObjectView {
+    public:
+        using Container = std::vector<std::shared_ptr<std::remove_const_t<T>>>;  ///< Vector owning the objects.
+
+        /**
+         * @brief Iterator yielding references to the objects of the view.
+         */
+        class Iterator {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::remove_const_t<T>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+
+            Iterator() = default;
+            explicit Iterator(typename Container::const_iterator position) : _position(position) {}
+
+            reference operator*() const { return **_position; }
+            pointer operator->() const { return _position->get(); }
+            reference operator[](difference_type offset) const { return *_position[offset]; }
+
+            Iterator& operator++() { ++_position; return *this; }
+            Iterator operator++(int) { Iterator previous = *this; ++_position; return previous; }
+            Iterator& operator--() { --_position; return *this; }
+            Iterator operator--(int) { Iterator previous = *this; --_position; return previous; }
+            Iterator& operator+=(difference_type offset) { _position += offset; return *this; }
+            Iterator& operator-=(difference_type offset) { _position -= offset; return *this; }
+            Iterator operator+(difference_type offset) const { return Iterator(_position + offset); }
+            Iterator operator-(difference_type offset) const { return Iterator(_position - offset); }
+            difference_type operator-(const Iterator& other) const { return _position - other._position; }
+
+            bool operator==(const Iterator& other) const { return _position == other._position; }
+            bool operator!=(const Iterator& other) const { return _position != other._position; }
+            bool operator<(const Iterator& other) const { return _position < other._position; }
+
+        private:
+            typename Container::const_iterator _position;  ///< Position in the owning vector.
+        };
+
+        /**
+         * @brief Constructs a view over the objects owned by a vector.
+         *
+         * @param objects The vector owning the objects, which must outlive the view.
+         */
+        explicit ObjectView(const Container& objects) : _objects(&objects) {}
+
+        Iterator begin() const { return Iterator(_objects->begin()); }
+        Iterator end() const { return Iterator(_objects->end()); }
+
+        /**
+         * @brief Retrieves the number of objects in the view.
+         */
+        size_t size() const { return _objects->size(); }
+
+        /**
+         * @brief Indicates whether the view has no object.
+         */
+        bool empty() const { return _objects->empty(); }
+
+        /**
+         * @brief Retrieves an object by position, without bounds checking.
+         */
+        T& operator[](size_t index) const { return *(*_objects)[index]; }
+
+    private:
+        const Container* _objects;  ///< Vector owning the objects.
+    };
+}
@@ -0,0 +1,111 @@
+/**
+ * @file SignalTable.cpp
+ * @brief Implementation of the SignalTable class.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <iterator>
+#include "SignalTable.hpp"
+
+namespace cantools_cpp
+{
+    namespace
+    {
+        template <typename T>
+        void moveAppend(std::vector<T>& target, std::vector<T>& source)
+        {
+            target.insert(target.end(), std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+            source.clear();
+        }
+    }
+
+    uint32_t SignalTable::addRow(const std::string& name, uint16_t startBit, uint16_t length, uint8_t byteOrder, uint8_t valueType, float factor, float offset,
+        float minVal, float maxVal, const std::string* unit, const std::string* receiver, const std::string* multiplexer)
+    {
+        uint32_t row = static_cast<uint32_t>(size());
+        _startBit.push_back(startBit);
+        _length.push_back(length);
+        _byteOrder.push_back(byteOrder);
+        _valueType.push_back(valueType);
+        _factor.push_back(factor);
+        _offset.push_back(offset);
+        _rawValue.push_back(0);
+        _physicalValue.push_back(0.0);
+
+        _name.push_back(name);
+        _minVal.push_back(minVal);
+        _maxVal.push_back(maxVal);
+        _unit.push_back(unit);
+        _receiver.push_back(receiver);
+        _multiplexer.push_back(multiplexer);
+        return row;
+    }
+
+    uint32_t SignalTable::copyRow(const SignalTable& source, uint32_t row)
+    {
+        uint32_t copy = addRow(source._name[row], source._startBit[row], source._length[row], source._byteOrder[row], source._valueType[row],
+            source._factor[row], source._offset[row], source._minVal[row], source._maxVal[row], source._unit[row], source._receiver[row], source._multiplexer[row]);
+        setValue(copy, source._rawValue[row], source._physicalValue[row]);
+        return copy;
+    }
+
+    uint32_t SignalTable::appendRows(SignalTable&& source)
+    {
+        uint32_t first = static_cast<uint32_t>(size());
+        moveAppend(_startBit, source._startBit);
+        moveAppend(_length, source._length);
+        moveAppend(_byteOrder, source._byteOrder);
+        moveAppend(_valueType, source._valueType);
+        moveAppend(_factor, source._factor);
+        moveAppend(_offset, source._offset);
+        moveAppend(_rawValue, source._rawValue);
+        moveAppend(_physicalValue, source._physicalValue);
+
+        moveAppend(_name, source._name);
+        moveAppend(_minVal, source._minVal);
+        moveAppend(_maxVal, source._maxVal);
+        moveAppend(_unit, source._unit);
+        moveAppend(_receiver, source._receiver);
+        moveAppend(_multiplexer, source._multiplexer);
+        return first;
+    }
+
+    void SignalTable::reserve(size_t rows)
+    {
+        _startBit.reserve(rows);
+        _length.reserve(rows);
+        _byteOrder.reserve(rows);
+        _valueType.reserve(rows);
+        _factor.reserve(rows);
+        _offset.reserve(rows);
+        _rawValue.reserve(rows);
+        _physicalValue.reserve(rows);
+
+        _name.reserve(rows);
+        _minVal.reserve(rows);
+        _maxVal.reserve(rows);
+        _unit.reserve(rows);
+        _receiver.reserve(rows);
+        _multiplexer.reserve(rows);
+    }
+
+    void SignalTable::shrinkToFit()
+    {
+        _startBit.shrink_to_fit();
+        _length.shrink_to_fit();
+        _byteOrder.shrink_to_fit();
+        _valueType.shrink_to_fit();
+        _factor.shrink_to_fit();
+        _offset.shrink_to_fit();
+        _rawValue.shrink_to_fit();
+        _physicalValue.shrink_to_fit();
+
+        _name.shrink_to_fit();
+        _minVal.shrink_to_fit();
+        _maxVal.shrink_to_fit();
+        _unit.shrink_to_fit();
+        _receiver.shrink_to_fit();
+        _multiplexer.shrink_to_fit();
+    }
+}
@@ -0,0 +1,140 @@
+/**
+ * @file SignalTable.hpp
+ * @brief Declaration of the SignalTable class, the struct-of-arrays storage of the signals of a CAN bus.
+ *
+ * Each signal is a row of the table. The fields read when decoding and encoding frames (bit position,
+ * length, byte order, value type, scaling and the current values) are kept in dense arrays, one per
+ * field, so that walking the signals of a bus touches a few contiguous cache lines. The descriptive
+ * fields (name, unit, receiver, multiplexer indicator and range) live in separate cold arrays.
+ *
+ * CANSignal objects are views over one row: a signal created on its own owns a single row table, and
+ * moves its row to the table of its bus when it is added to it. Rows are never removed nor reordered,
+ * so the row of a signal stays valid while the table grows.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cantools_cpp
+{
+    class SignalTable {
+    public:
+        /**
+         * @brief Appends a row with the given layout, scaling and metadata; the values start at 0.
+         *
+         * @param name The name of the signal.
+         * @param startBit The starting bit position of the signal.
+         * @param length The length of the signal in bits.
+         * @param byteOrder The byte order of the signal.
+         * @param valueType The value type of the signal, a DbcValueType.
+         * @param factor The scaling factor.
+         * @param offset The offset applied after scaling.
+         * @param minVal The minimum physical value.
+         * @param maxVal The maximum physical value.
+         * @param unit The unit, pooled by the signal.
+         * @param receiver The receiver, pooled by the signal.
+         * @param multiplexer The multiplexer indicator, pooled by the signal.
+         * @return The index of the new row.
+         */
+        uint32_t addRow(const std::string& name, uint16_t startBit, uint16_t length, uint8_t byteOrder, uint8_t valueType, float factor, float offset,
+            float minVal, float maxVal, const std::string* unit, const std::string* receiver, const std::string* multiplexer);
+
+        /**
+         * @brief Appends a copy of a row of another table.
+         *
+         * @param source The table holding the row.
+         * @param row The row to copy.
+         * @return The index of the new row.
+         */
+        uint32_t copyRow(const SignalTable& source, uint32_t row);
+
+        /**
+         * @brief Moves all the rows of another table to the end of this one, leaving the other table empty.
+         *
+         * The signals viewing the moved rows follow them with CANSignal::followRows().
+         *
+         * @param source The table giving its rows.
+         * @return The index in this table of the first moved row.
+         */
+        uint32_t appendRows(SignalTable&& source);
+
+        /**
+         * @brief Retrieves the number of rows.
+         *
+         * @return The number of signals stored in the table.
+         */
+        size_t size() const { return _startBit.size(); }
+
+        /**
+         * @brief Reserves room for a number of rows.
+         *
+         * @param rows The expected number of rows.
+         */
+        void reserve(size_t rows);
+
+        /**
+         * @brief Releases the capacity left over by the growth of the arrays, once all the signals are added.
+         */
+        void shrinkToFit();
+
+        // Hot fields
+        uint16_t getStartBit(uint32_t row) const { return _startBit[row]; }
+        uint16_t getLength(uint32_t row) const { return _length[row]; }
+        uint8_t getByteOrder(uint32_t row) const { return _byteOrder[row]; }
+        uint8_t getValueType(uint32_t row) const { return _valueType[row]; }
+        float getFactor(uint32_t row) const { return _factor[row]; }
+        float getOffset(uint32_t row) const { return _offset[row]; }
+        uint64_t getRawValue(uint32_t row) const { return _rawValue[row]; }
+        double getPhysicalValue(uint32_t row) const { return _physicalValue[row]; }
+
+        void setStartBit(uint32_t row, uint16_t startBit) { _startBit[row] = startBit; }
+        void setLength(uint32_t row, uint16_t length) { _length[row] = length; }
+        void setByteOrder(uint32_t row, uint8_t byteOrder) { _byteOrder[row] = byteOrder; }
+        void setValueType(uint32_t row, uint8_t valueType) { _valueType[row] = valueType; }
+        void setFactor(uint32_t row, float factor) { _factor[row] = factor; }
+        void setOffset(uint32_t row, float offset) { _offset[row] = offset; }
+
+        /**
+         * @brief Stores the current raw and physical values of a signal.
+         */
+        void setValue(uint32_t row, uint64_t rawValue, double physicalValue) {
+            _rawValue[row] = rawValue;
+            _physicalValue[row] = physicalValue;
+        }
+
+        // Cold fields
+        const std::string& getName(uint32_t row) const { return _name[row]; }
+        float getMinVal(uint32_t row) const { return _minVal[row]; }
+        float getMaxVal(uint32_t row) const { return _maxVal[row]; }
+        const std::string& getUnit(uint32_t row) const { return *_unit[row]; }
+        const std::string& getReceiver(uint32_t row) const { return *_receiver[row]; }
+        const std::string& getMultiplexer(uint32_t row) const { return *_multiplexer[row]; }
+
+        void setName(uint32_t row, const std::string& name) { _name[row] = name; }
+
+    private:
+        // Hot fields, read on every decode and encode
+        std::vector<uint16_t> _startBit;        ///< Starting bit position of each signal.
+        std::vector<uint16_t> _length;          ///< Length in bits of each signal.
+        std::vector<uint8_t> _byteOrder;        ///< Byte order of each signal.
+        std::vector<uint8_t> _valueType;        ///< DbcValueType of each signal.
+        std::vector<float> _factor;             ///< Scaling factor of each signal.
+        std::vector<float> _offset;             ///< Offset of each signal.
+        std::vector<uint64_t> _rawValue;        ///< Current raw value of each signal.
+        std::vector<double> _physicalValue;     ///< Current physical value of each signal.
+
+        // Cold fields, for display, code generation and lookups by name
+        std::vector<std::string> _name;                 ///< Name of each signal.
+        std::vector<float> _minVal;                     ///< Minimum physical value of each signal.
+        std::vector<float> _maxVal;                     ///< Maximum physical value of each signal.
+        std::vector<const std::string*> _unit;          ///< Pooled unit of each signal.
+        std::vector<const std::string*> _receiver;      ///< Pooled receiver of each signal.
+        std::vector<const std::string*> _multiplexer;   ///< Pooled multiplexer indicator of each signal.
+    };
+}
@@ -0,0 +1,39 @@
+/**
+ * @file StringPool.cpp
+ * @brief Implementation of the StringPool class.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include "StringPool.hpp"
+
+namespace cantools_cpp
+{
+    const std::string& StringPool::intern(const std::string& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return *_strings.insert(value).first;
+    }
+
+    size_t StringPool::size() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _strings.size();
+    }
+
+    size_t StringPool::getMemoryUsage() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        size_t bytes = _strings.bucket_count() * sizeof(void*);
+        for (const std::string& value : _strings) {
+            // Node: next pointer, cached hash and the string, plus the characters beyond the small string buffer
+            bytes += 2 * sizeof(void*) + sizeof(std::string);
+            if (value.capacity() >= sizeof(std::string) / 2) {
+                bytes += value.capacity() + 1;
+            }
+        }
+        return bytes;
+    }
+
+    std::shared_ptr<StringPool> StringPool::getShared() {
+        static std::shared_ptr<StringPool> pool = std::make_shared<StringPool>();
+        return pool;
+    }
+}
@@ -0,0 +1,59 @@
+/**
+ * @file StringPool.hpp
+ * @brief Declaration of the StringPool class, which interns the metadata strings shared by many signals and messages.
+ *
+ * Units, receivers, transmitters and multiplexer indicators repeat across the signals of a database
+ * ("km/h", "Vector__XXX", ...). Signals and messages keep a pointer to one pooled copy of each of them
+ * instead of a std::string of their own. Pooled strings are never released nor moved, so the references
+ * returned by intern() stay valid as long as the pool lives; objects holding such references also hold
+ * the pool. Each CANBusManager owns a pool shared by all the objects it creates.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+namespace cantools_cpp
+{
+    class StringPool {
+    public:
+        /**
+         * @brief Retrieves the pooled copy of a string, adding it to the pool on first use.
+         *
+         * @param value The string to intern.
+         * @return A reference to the pooled string, valid for the lifetime of the pool.
+         */
+        const std::string& intern(const std::string& value);
+
+        /**
+         * @brief Retrieves the number of distinct strings in the pool.
+         *
+         * @return The number of strings.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Estimates the heap memory used by the pool.
+         *
+         * @return The size in bytes of the pooled strings, their characters and the hash table buckets.
+         */
+        size_t getMemoryUsage() const;
+
+        /**
+         * @brief Retrieves the pool used by objects created without one, outside of a CANBusManager.
+         *
+         * @return The process wide pool.
+         */
+        static std::shared_ptr<StringPool> getShared();
+
+    private:
+        mutable std::mutex _mutex;               ///< Protects _strings, the pool may be shared by parsing threads.
+        std::unordered_set<std::string> _strings;  ///< Pooled strings; set nodes never move.
+    };
+}
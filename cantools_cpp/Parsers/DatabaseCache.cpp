@@ -0,0 +1,405 @@
+/**
+ * @file DatabaseCache.cpp
+ * @brief Implementation of the DatabaseCache class.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "DatabaseCache.hpp"
+#include "MappedFile.hpp"
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "Logger.hpp"
+
+namespace cantools_cpp
+{
+    namespace
+    {
+        constexpr char Magic[8] = { 'C', 'A', 'N', 'D', 'B', 'C', 'C', '\0' };
+        constexpr uint32_t ByteOrderMark = 0x01020304;
+        constexpr uint64_t FnvOffsetBasis = 14695981039346656037ull;
+        constexpr uint64_t FnvPrime = 1099511628211ull;
+
+        // Location of a string in the string blob
+        struct StringRef {
+            uint32_t offset;
+            uint32_t length;
+        };
+
+        // Layout of the file: header, ranges, nodes, messages, additional transmitters, signals, string blob.
+        // The sections are laid out from the most to the least aligned record, so that every record is aligned in the mapping.
+        struct Header {
+            char magic[8];
+            uint32_t version;
+            uint32_t byteOrderMark;
+            uint64_t sourceHash;
+            uint64_t sourceSize;
+            uint64_t payloadHash;
+            uint64_t payloadSize;
+            uint32_t rangeCount;
+            uint32_t nodeCount;
+            uint32_t messageCount;
+            uint32_t transmitterCount;
+            uint32_t signalCount;
+            uint32_t stringBytes;
+        };
+
+        struct RangeRecord {
+            uint64_t low;
+            uint64_t high;
+        };
+
+        struct NodeRecord {
+            StringRef name;
+        };
+
+        struct MessageRecord {
+            uint32_t id;
+            int32_t length;
+            StringRef name;
+            StringRef transmitter;
+            uint32_t transmitterBegin;
+            uint32_t transmitterCount;
+            uint32_t signalBegin;
+            uint32_t signalCount;
+        };
+
+        struct SignalRecord {
+            StringRef name;
+            StringRef unit;
+            StringRef receiver;
+            StringRef multiplexer;
+            StringRef multiplexorName;
+            float factor;
+            float offset;
+            float minVal;
+            float maxVal;
+            uint32_t rangeBegin;
+            uint32_t rangeCount;
+            uint8_t startBit;
+            uint8_t length;
+            uint8_t byteOrder;
+            uint8_t valueType;
+        };
+
+        static_assert(sizeof(Header) == 72 && sizeof(RangeRecord) == 16 && sizeof(NodeRecord) == 8 && sizeof(MessageRecord) == 40 && sizeof(SignalRecord) == 68,
+            "The cache records must not contain padding");
+
+        uint64_t fnv1a(uint64_t hash, const uint8_t* data, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i) {
+                hash = (hash ^ data[i]) * FnvPrime;
+            }
+            return hash;
+        }
+
+        // Collects the records and the deduplicated strings of a bus
+        class CacheWriter {
+        public:
+            StringRef addString(const std::string& value) {
+                auto found = _stringRefs.find(value);
+                if (found != _stringRefs.end()) {
+                    return found->second;
+                }
+                StringRef reference{ static_cast<uint32_t>(_strings.size()), static_cast<uint32_t>(value.size()) };
+                _strings += value;
+                _stringRefs.emplace(value, reference);
+                return reference;
+            }
+
+            std::vector<RangeRecord> ranges;
+            std::vector<NodeRecord> nodes;
+            std::vector<MessageRecord> messages;
+            std::vector<StringRef> transmitters;
+            std::vector<SignalRecord> signals;
+
+            std::vector<uint8_t> serialize(uint64_t sourceHash, uint64_t sourceSize) const {
+                Header header{};
+                std::memcpy(header.magic, Magic, sizeof(Magic));
+                header.version = DatabaseCache::FormatVersion;
+                header.byteOrderMark = ByteOrderMark;
+                header.sourceHash = sourceHash;
+                header.sourceSize = sourceSize;
+                header.rangeCount = static_cast<uint32_t>(ranges.size());
+                header.nodeCount = static_cast<uint32_t>(nodes.size());
+                header.messageCount = static_cast<uint32_t>(messages.size());
+                header.transmitterCount = static_cast<uint32_t>(transmitters.size());
+                header.signalCount = static_cast<uint32_t>(signals.size());
+                header.stringBytes = static_cast<uint32_t>(_strings.size());
+
+                std::vector<uint8_t> image(sizeof(Header));
+                append(image, ranges.data(), ranges.size() * sizeof(RangeRecord));
+                append(image, nodes.data(), nodes.size() * sizeof(NodeRecord));
+                append(image, messages.data(), messages.size() * sizeof(MessageRecord));
+                append(image, transmitters.data(), transmitters.size() * sizeof(StringRef));
+                append(image, signals.data(), signals.size() * sizeof(SignalRecord));
+                append(image, _strings.data(), _strings.size());
+
+                header.payloadSize = image.size() - sizeof(Header);
+                header.payloadHash = fnv1a(FnvOffsetBasis, image.data() + sizeof(Header), header.payloadSize);
+                std::memcpy(image.data(), &header, sizeof(Header));
+                return image;
+            }
+
+        private:
+            static void append(std::vector<uint8_t>& image, const void* data, size_t size) {
+                const uint8_t* bytes = static_cast<const uint8_t*>(data);
+                image.insert(image.end(), bytes, bytes + size);
+            }
+
+            std::string _strings;                                     ///< String blob.
+            std::unordered_map<std::string, StringRef> _stringRefs;  ///< Location of each string already in the blob.
+        };
+
+        // Read-only access to the sections of a mapped cache, valid once check() succeeded
+        class CacheReader {
+        public:
+            explicit CacheReader(const MappedFile& file) : _file(file) {}
+
+            bool check(uint64_t sourceHash, uint64_t sourceSize) {
+                if (_file.size() < sizeof(Header)) {
+                    return false;
+                }
+
+                _header = reinterpret_cast<const Header*>(_file.data());
+                if (std::memcmp(_header->magic, Magic, sizeof(Magic)) != 0 || _header->version != DatabaseCache::FormatVersion
+                    || _header->byteOrderMark != ByteOrderMark || _header->sourceHash != sourceHash || _header->sourceSize != sourceSize) {
+                    return false;
+                }
+
+                uint64_t expectedSize = uint64_t(_header->rangeCount) * sizeof(RangeRecord) + uint64_t(_header->nodeCount) * sizeof(NodeRecord)
+                    + uint64_t(_header->messageCount) * sizeof(MessageRecord) + uint64_t(_header->transmitterCount) * sizeof(StringRef)
+                    + uint64_t(_header->signalCount) * sizeof(SignalRecord) + _header->stringBytes;
+                if (_header->payloadSize != expectedSize || _file.size() - sizeof(Header) != expectedSize
+                    || fnv1a(FnvOffsetBasis, _file.data() + sizeof(Header), expectedSize) != _header->payloadHash) {
+                    return false;
+                }
+
+                const uint8_t* section = _file.data() + sizeof(Header);
+                ranges = reinterpret_cast<const RangeRecord*>(section);
+                section += _header->rangeCount * sizeof(RangeRecord);
+                nodes = reinterpret_cast<const NodeRecord*>(section);
+                section += _header->nodeCount * sizeof(NodeRecord);
+                messages = reinterpret_cast<const MessageRecord*>(section);
+                section += _header->messageCount * sizeof(MessageRecord);
+                transmitters = reinterpret_cast<const StringRef*>(section);
+                section += _header->transmitterCount * sizeof(StringRef);
+                signals = reinterpret_cast<const SignalRecord*>(section);
+                section += _header->signalCount * sizeof(SignalRecord);
+                _strings = reinterpret_cast<const char*>(section);
+
+                return checkReferences();
+            }
+
+            const Header& header() const { return *_header; }
+
+            std::string string(StringRef reference) const { return std::string(_strings + reference.offset, reference.length); }
+
+            const RangeRecord* ranges = nullptr;
+            const NodeRecord* nodes = nullptr;
+            const MessageRecord* messages = nullptr;
+            const StringRef* transmitters = nullptr;
+            const SignalRecord* signals = nullptr;
+
+        private:
+            bool validString(StringRef reference) const {
+                return uint64_t(reference.offset) + reference.length <= _header->stringBytes;
+            }
+
+            static bool validSpan(uint32_t begin, uint32_t count, uint32_t size) {
+                return uint64_t(begin) + count <= size;
+            }
+
+            // The payload hash rules out damaged files; this guards against a cache written by a faulty writer
+            bool checkReferences() const {
+                for (uint32_t i = 0; i < _header->nodeCount; ++i) {
+                    if (!validString(nodes[i].name)) {
+                        return false;
+                    }
+                }
+                for (uint32_t i = 0; i < _header->transmitterCount; ++i) {
+                    if (!validString(transmitters[i])) {
+                        return false;
+                    }
+                }
+                for (uint32_t i = 0; i < _header->messageCount; ++i) {
+                    const MessageRecord& message = messages[i];
+                    if (!validString(message.name) || !validString(message.transmitter)
+                        || !validSpan(message.transmitterBegin, message.transmitterCount, _header->transmitterCount)
+                        || !validSpan(message.signalBegin, message.signalCount, _header->signalCount)) {
+                        return false;
+                    }
+                }
+                for (uint32_t i = 0; i < _header->signalCount; ++i) {
+                    const SignalRecord& signal = signals[i];
+                    if (!validString(signal.name) || !validString(signal.unit) || !validString(signal.receiver) || !validString(signal.multiplexer)
+                        || !validString(signal.multiplexorName) || !validSpan(signal.rangeBegin, signal.rangeCount, _header->rangeCount)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            const MappedFile& _file;
+            const Header* _header = nullptr;
+            const char* _strings = nullptr;
+        };
+    }
+
+    uint64_t DatabaseCache::hash(const uint8_t* data, size_t size)
+    {
+        return fnv1a(FnvOffsetBasis, data, size);
+    }
+
+    bool DatabaseCache::write(const CANBus& bus, const std::string& cacheFile, uint64_t sourceHash, uint64_t sourceSize)
+    {
+        CacheWriter writer;
+
+        for (const auto& node : bus.getNodes()) {
+            writer.nodes.push_back({ writer.addString(node->getName()) });
+        }
+
+        for (const auto& message : bus.getAllMessages()) {
+            MessageRecord record{};
+            record.id = message->getId();
+            record.length = message->getLength();
+            record.name = writer.addString(message->getName());
+            record.transmitter = writer.addString(message->getTransmitter());
+
+            record.transmitterBegin = static_cast<uint32_t>(writer.transmitters.size());
+            for (const auto& transmitter : message->getAdditionalTransmitters()) {
+                writer.transmitters.push_back(writer.addString(transmitter));
+            }
+            record.transmitterCount = static_cast<uint32_t>(writer.transmitters.size()) - record.transmitterBegin;
+
+            record.signalBegin = static_cast<uint32_t>(writer.signals.size());
+            for (const auto& signal : message->getSignals()) {
+                SignalRecord definition{};
+                definition.name = writer.addString(signal->getName());
+                definition.unit = writer.addString(signal->getUnit());
+                definition.receiver = writer.addString(signal->getReceiver());
+                definition.multiplexer = writer.addString(signal->getMultiplexer());
+                definition.multiplexorName = writer.addString(signal->getMultiplexorName());
+                definition.factor = signal->getFactor();
+                definition.offset = signal->getOffset();
+                definition.minVal = signal->getMinVal();
+                definition.maxVal = signal->getMaxVal();
+                definition.startBit = signal->getStartBit();
+                definition.length = signal->getLength();
+                definition.byteOrder = signal->getByteOrder();
+                definition.valueType = static_cast<uint8_t>(signal->getValueType());
+
+                definition.rangeBegin = static_cast<uint32_t>(writer.ranges.size());
+                for (const auto& range : signal->getMultiplexerValues()) {
+                    writer.ranges.push_back({ range.low, range.high });
+                }
+                definition.rangeCount = static_cast<uint32_t>(writer.ranges.size()) - definition.rangeBegin;
+
+                writer.signals.push_back(definition);
+            }
+            record.signalCount = static_cast<uint32_t>(writer.signals.size()) - record.signalBegin;
+
+            writer.messages.push_back(record);
+        }
+
+        std::vector<uint8_t> image = writer.serialize(sourceHash, sourceSize);
+
+        // Unique temporary name: several processes may write the cache of the same DBC at once
+        std::string temporaryFile = cacheFile + ".tmp" + std::to_string(std::random_device{}());
+        {
+            std::ofstream file(temporaryFile, std::ios::binary | std::ios::trunc);
+            if (!file.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()))) {
+                Logger::getInstance().log("Could not write database cache " + temporaryFile, Logger::LOG_WARNING);
+                file.close();
+                std::error_code ignored;
+                std::filesystem::remove(temporaryFile, ignored);
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporaryFile, cacheFile, error);
+        if (error) {
+            Logger::getInstance().log("Could not write database cache " + cacheFile + ": " + error.message(), Logger::LOG_WARNING);
+            std::filesystem::remove(temporaryFile, error);
+            return false;
+        }
+        return true;
+    }
+
+    bool DatabaseCache::load(const std::string& cacheFile, uint64_t sourceHash, uint64_t sourceSize, const std::shared_ptr<CANBusManager>& busManager,
+        const std::string& busName)
+    {
+        MappedFile file(cacheFile);
+        if (!file.isOpen()) {
+            return false;
+        }
+
+        CacheReader cache(file);
+        if (!cache.check(sourceHash, sourceSize)) {
+            Logger::getInstance().log("Database cache " + cacheFile + " is stale or invalid", Logger::LOG_DEBUG);
+            return false;
+        }
+
+        // Same steps as the line parsers, in the order of the DBC
+        busManager->createBus(busName);
+        auto bus = busManager->getBus(busName);
+        auto stringPool = busManager->getStringPool();
+        const Header& header = cache.header();
+
+        for (uint32_t i = 0; i < header.nodeCount; ++i) {
+            std::shared_ptr<CANNode> node = bus->create<CANNode>(cache.string(cache.nodes[i].name), busName, *busManager);
+            node->attachToBus();
+        }
+
+        for (uint32_t i = 0; i < header.messageCount; ++i) {
+            const MessageRecord& record = cache.messages[i];
+            std::shared_ptr<CANMessage> message = bus->create<CANMessage>(record.id, stringPool, bus->getArena().get());
+            message->setName(cache.string(record.name));
+            message->setLength(record.length);
+            message->setTransmitter(cache.string(record.transmitter));
+
+            auto canNode = bus->getNodeByName(message->getTransmitter());
+            if (canNode) {
+                canNode->addMessage(message);
+            }
+            else {
+                bus->addMessage(message);
+            }
+
+            if (record.transmitterCount > 0) {
+                std::vector<std::string> transmitters;
+                for (uint32_t t = record.transmitterBegin; t < record.transmitterBegin + record.transmitterCount; ++t) {
+                    transmitters.push_back(cache.string(cache.transmitters[t]));
+                }
+                message->setAdditionalTransmitters(transmitters);
+            }
+
+            for (uint32_t s = record.signalBegin; s < record.signalBegin + record.signalCount; ++s) {
+                const SignalRecord& definition = cache.signals[s];
+                auto signal = bus->create<CANSignal>(cache.string(definition.name), definition.startBit, definition.length, definition.factor, definition.offset,
+                    definition.minVal, definition.maxVal, cache.string(definition.unit), definition.byteOrder, definition.valueType, cache.string(definition.receiver),
+                    cache.string(definition.multiplexer), stringPool, bus->getSignalTable(), bus->getArena().get());
+                bus->addSignal(signal);
+
+                // SG_MUL_VAL_ ranges replace the value of the multiplexer indicator
+                if (definition.multiplexorName.length > 0) {
+                    std::vector<MultiplexerRange> values;
+                    for (uint32_t r = definition.rangeBegin; r < definition.rangeBegin + definition.rangeCount; ++r) {
+                        values.push_back({ cache.ranges[r].low, cache.ranges[r].high });
+                    }
+                    signal->setMultiplexerValues(cache.string(definition.multiplexorName), values);
+                }
+            }
+        }
+
+        bus->build();
+        return true;
+    }
+}
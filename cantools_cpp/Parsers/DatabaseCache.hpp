@@ -0,0 +1,69 @@
+/**
+ * @file DatabaseCache.hpp
+ * @brief Declaration of the DatabaseCache class, a binary image of a loaded bus that is memory mapped on the next load.
+ *
+ * Parsing a large DBC with the line parsers takes a while; the cache file stores the nodes, messages and
+ * signals of the built bus as fixed size records followed by one string blob, so that the next load only
+ * maps the file and creates the objects from the records. The header records a FNV-1a hash and the size of
+ * the DBC the cache was written from, and a hash of the cache itself; a cache that does not match the DBC,
+ * that was written by another format version or that is damaged is rejected and the DBC is parsed again.
+ *
+ * Records are stored in the byte order of the writer, a cache is only valid on hosts of the same endianness.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace cantools_cpp
+{
+    class CANBus;
+    class CANBusManager;
+
+    class DatabaseCache {
+    public:
+        static constexpr uint32_t FormatVersion = 1;  ///< Incremented whenever the layout of the records changes.
+
+        /**
+         * @brief Computes the hash identifying the content of a DBC file.
+         *
+         * @param data The content of the file.
+         * @param size The size of the content in bytes.
+         * @return The 64-bit FNV-1a hash of the content.
+         */
+        static uint64_t hash(const uint8_t* data, size_t size);
+
+        /**
+         * @brief Writes the cache of a built bus.
+         *
+         * The file is written under a temporary name and renamed, so that concurrent loads never map a partial cache.
+         *
+         * @param bus The bus, after CANBus::build().
+         * @param cacheFile The path of the cache file.
+         * @param sourceHash The hash of the DBC the bus was loaded from.
+         * @param sourceSize The size of the DBC in bytes.
+         * @return true if the cache was written.
+         */
+        static bool write(const CANBus& bus, const std::string& cacheFile, uint64_t sourceHash, uint64_t sourceSize);
+
+        /**
+         * @brief Creates and builds a bus from a cache file.
+         *
+         * Nothing is created unless the whole cache is valid for the given DBC.
+         *
+         * @param cacheFile The path of the cache file.
+         * @param sourceHash The hash of the DBC to load.
+         * @param sourceSize The size of the DBC in bytes.
+         * @param busManager The manager receiving the bus.
+         * @param busName The name of the bus to create.
+         * @return true if the bus was created from the cache, false if the cache is missing, stale or invalid.
+         */
+        static bool load(const std::string& cacheFile, uint64_t sourceHash, uint64_t sourceSize, const std::shared_ptr<CANBusManager>& busManager,
+            const std::string& busName);
+    };
+}
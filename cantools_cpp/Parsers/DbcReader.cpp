@@ -0,0 +1,177 @@
+/**
+ * @file DbcReader.cpp
+ * @brief Implementation of the DbcReader class.
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <cstring>
+#include "DbcReader.hpp"
+#include "DbcTokenizer.hpp"
+
+namespace cantools_cpp
+{
+    namespace
+    {
+        // Follows the quoted strings and the ';' ending a statement over one of its lines
+        void scanLine(std::string_view line, bool& quoted, bool& closed)
+        {
+            for (size_t i = 0; i < line.size(); ++i) {
+                char c = line[i];
+                if (quoted) {
+                    if (c == '\\') {
+                        ++i;
+                    }
+                    else if (c == '"') {
+                        quoted = false;
+                    }
+                }
+                else if (c == '"') {
+                    quoted = true;
+                }
+                else if (c == ';') {
+                    closed = true;
+                }
+            }
+        }
+    }
+
+    DbcReader::DbcReader(const std::string& path)
+        : _file(path)
+    {
+        if (_file.isOpen()) {
+            _file.adviseSequential();
+            _data = reinterpret_cast<const char*>(_file.data());
+            _size = _file.size();
+        }
+        else {
+            _stream.open(path, std::ios::binary);
+        }
+    }
+
+    bool DbcReader::isMultiLine(std::string_view keyword)
+    {
+        // Only the header, the nodes, the messages and the signals are not terminated by ';'
+        return !keyword.empty() && keyword != "SG_" && keyword != "BO_" && keyword != "BU_" && keyword != "BS_" && keyword != "NS_"
+            && keyword != "VERSION";
+    }
+
+    bool DbcReader::next(std::string_view& statement)
+    {
+        if (_file.isOpen() && _position - _released >= ReleaseSize) {
+            // Views into the released part stay valid, its pages are read again if touched
+            _file.release(_released, _position - _released);
+            _released = _position;
+        }
+
+        size_t begin = 0;
+        size_t end = 0;
+        for (;;) {
+            _start = _position;
+            if (!readLine(begin, end)) {
+                return false;
+            }
+
+            DbcTokenizer tokens(std::string_view(_data + begin, end - begin));
+            tokens.skipSpace();
+            if (tokens.atEnd()) {
+                continue;
+            }
+
+            std::string_view keyword;
+            tokens.readIdentifier(keyword);
+            if (!isMultiLine(keyword)) {
+                statement = std::string_view(_data + _start, end - _start);
+                return true;
+            }
+
+            // Lines are added while a string is open, or until the ';' as long as they do not start a new statement
+            size_t length = end - _start;
+            bool quoted = false;
+            bool closed = false;
+            scanLine(std::string_view(_data + begin, end - begin), quoted, closed);
+            while (quoted || !closed) {
+                if (!quoted) {
+                    char c = peekLineStart();
+                    if (c == '\0' || c == '\n' || DbcTokenizer::isIdentifierStart(c)) {
+                        break;
+                    }
+                }
+                if (!readLine(begin, end)) {
+                    break;
+                }
+                length = end - _start;
+                scanLine(std::string_view(_data + begin, end - begin), quoted, closed);
+            }
+
+            statement = std::string_view(_data + _start, length);
+            return true;
+        }
+    }
+
+    bool DbcReader::readLine(size_t& begin, size_t& end)
+    {
+        size_t scanned = 0;
+        for (;;) {
+            size_t available = _size - _position;
+            const void* newline = available > scanned ? std::memchr(_data + _position + scanned, '\n', available - scanned) : nullptr;
+            if (newline) {
+                begin = _position;
+                end = static_cast<size_t>(static_cast<const char*>(newline) - _data);
+                _position = end + 1;
+                return true;
+            }
+
+            scanned = available;
+            if (!refill()) {
+                if (available == 0) {
+                    return false;
+                }
+                // Last line, without a line break
+                begin = _position;
+                end = _size;
+                _position = _size;
+                return true;
+            }
+        }
+    }
+
+    char DbcReader::peekLineStart()
+    {
+        size_t scanned = 0;
+        for (;;) {
+            for (; _position + scanned < _size; ++scanned) {
+                char c = _data[_position + scanned];
+                if (c == '\n' || !DbcTokenizer::isSpace(c)) {
+                    return c;
+                }
+            }
+            if (!refill()) {
+                return '\0';
+            }
+        }
+    }
+
+    bool DbcReader::refill()
+    {
+        if (!_stream.is_open() || !_stream) {
+            return false;
+        }
+
+        // Move the statement being read to the front of the buffer, and read a block after it
+        size_t kept = _size - _start;
+        if (_start > 0) {
+            std::memmove(_buffer.data(), _buffer.data() + _start, kept);
+            _position -= _start;
+            _start = 0;
+        }
+        if (_buffer.size() < kept + BlockSize) {
+            _buffer.resize(kept + BlockSize);
+        }
+
+        _stream.read(_buffer.data() + kept, static_cast<std::streamsize>(_buffer.size() - kept));
+        _data = _buffer.data();
+        _size = kept + static_cast<size_t>(_stream.gcount());
+        return _size > kept;
+    }
+}
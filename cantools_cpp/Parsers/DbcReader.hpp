@@ -0,0 +1,79 @@
+/**
+ * @file DbcReader.hpp
+ * @brief Declaration of the DbcReader class, which splits a DBC file into statements without copying it.
+ *
+ * The file is memory mapped and each statement is handed out as a std::string_view into the mapping.
+ * Statements end with their line, except the ones ending with ';' (CM_, VAL_TABLE_, BA_, ...), which
+ * go on over the following lines until the ';', and quoted strings, which may hold line breaks. The
+ * part of the mapping already read is dropped from memory as the reader moves on, so the memory used
+ * stays bounded whatever the size of the file. Files that cannot be mapped (pipes, ...) are read in
+ * blocks instead; the buffer then only grows to hold the longest statement.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "MappedFile.hpp"
+
+namespace cantools_cpp
+{
+    class DbcReader {
+    public:
+        static constexpr size_t BlockSize = 1024 * 1024;        ///< Size of the reads when the file is not mapped.
+        static constexpr size_t ReleaseSize = 8 * 1024 * 1024;  ///< Size of the mapped input read before it is dropped from memory.
+
+        /**
+         * @brief Opens a DBC file.
+         *
+         * @param path The path of the file; check isOpen() for failures.
+         */
+        explicit DbcReader(const std::string& path);
+
+        /**
+         * @brief Indicates whether the file could be opened.
+         */
+        bool isOpen() const { return _file.isOpen() || _stream.is_open(); }
+
+        /**
+         * @brief Indicates whether the file is memory mapped rather than read in blocks.
+         */
+        bool isMapped() const { return _file.isOpen(); }
+
+        /**
+         * @brief Reads the next statement, skipping blank lines.
+         *
+         * @param statement Set to the statement, without its last line break. It is only valid until the
+         *                  next call, or as long as the reader when the file is mapped.
+         * @return false at the end of the file.
+         */
+        bool next(std::string_view& statement);
+
+        /**
+         * @brief Indicates whether the statements of a keyword end with ';' and may span several lines.
+         *
+         * @param keyword The DBC keyword, e.g. "CM_".
+         */
+        static bool isMultiLine(std::string_view keyword);
+
+    private:
+        bool readLine(size_t& begin, size_t& end);
+        char peekLineStart();
+        bool refill();
+
+        MappedFile _file;            ///< Mapping of the file, if it could be mapped.
+        std::ifstream _stream;       ///< Stream of the file otherwise.
+        std::vector<char> _buffer;   ///< Blocks read from the stream.
+        const char* _data = nullptr; ///< Input available: the mapping, or the buffer.
+        size_t _size = 0;            ///< Size of the input available.
+        size_t _start = 0;           ///< Start of the statement being read, kept when the buffer is refilled.
+        size_t _position = 0;        ///< Start of the next line.
+        size_t _released = 0;        ///< End of the part of the mapping dropped from memory.
+    };
+}
@@ -6,40 +6,157 @@
  * @date 10/02/2024
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <exception>
 #include <filesystem>
+#include <mutex>
+#include <thread>
 #include "Parser.hpp"
 #include "NodeLineParser.hpp"
 #include "IgnoreLineParser.hpp"
 #include "MessageLineParser.hpp"
 #include "ExtraMessageLineParser.hpp"
 #include "SignalLineParser.hpp"
+#include "SignalValueTypeLineParser.hpp"
+#include "SignalMultiplexerValueLineParser.hpp"
+#include "DatabaseCache.hpp"
+#include "DbcReader.hpp"
+#include "MappedFile.hpp"
 #include "Logger.hpp"
 #include "CANBus.hpp"
 
 namespace cantools_cpp
 {
+    namespace
+    {
+        constexpr size_t ChunkStatements = 2048;                    // Statements parsed by a thread at once, up to the next BO_
+        constexpr size_t ParallelStatements = 2 * ChunkStatements;  // Smallest run of message statements parsed on several threads
+
+        // Bus parsing a chunk of message statements on a worker thread: the messages and signals are created in its
+        // arena and signal table, and their additions are recorded to be replayed on the real bus in file order
+        class ChunkBus : public CANBus {
+        public:
+            explicit ChunkBus(const std::string& name) : CANBus(name) {}
+
+            void addTransmittedMessage(const std::shared_ptr<CANMessage>& message) override {
+                _additions.push_back({ message, nullptr });
+            }
+
+            void addSignal(const std::shared_ptr<CANSignal>& signal) override {
+                _additions.push_back({ nullptr, signal });
+            }
+
+            // Adds the messages and signals as the statements would have, so that duplicates and the current message
+            // of the SG_ statements are handled by the real bus; the signal rows are moved to its table at once
+            void replay(CANBus& bus) {
+                const auto& table = bus.getSignalTable();
+                uint32_t offset = table->appendRows(std::move(*getSignalTable()));
+
+                for (const auto& addition : _additions) {
+                    if (addition.message) {
+                        bus.addTransmittedMessage(addition.message);
+                    }
+                    else {
+                        if (addition.signal->getSignalTable() == getSignalTable()) {
+                            addition.signal->followRows(table, offset);
+                        }
+                        bus.addSignal(addition.signal);
+                    }
+                }
+            }
+
+        private:
+            struct Addition {
+                std::shared_ptr<CANMessage> message;
+                std::shared_ptr<CANSignal> signal;
+            };
+
+            std::vector<Addition> _additions;
+        };
+
+        // Bus manager handing the chunk bus to the line parsers, with the string pool of the real bus manager
+        class ChunkBusManager : public CANBusManager {
+        public:
+            ChunkBusManager(const std::string& busName, std::shared_ptr<StringPool> stringPool)
+                : CANBusManager(std::move(stringPool)), _bus(std::make_shared<ChunkBus>(busName)) {}
+
+            std::shared_ptr<CANBus> getBus(const std::string& /*busName*/) override {
+                return _bus;
+            }
+
+            ChunkBus& getChunkBus() { return *_bus; }
+
+        private:
+            std::shared_ptr<ChunkBus> _bus;
+        };
+
+        // Hashes the content of a DBC file for its database cache; false if the file cannot be opened
+        bool hashSource(const std::string& fileDir, uint64_t& hash, uint64_t& size) {
+            MappedFile source(fileDir);
+            if (!source.isOpen()) {
+                return false;
+            }
+            hash = DatabaseCache::hash(source.data(), source.size());
+            size = source.size();
+            return true;
+        }
+    }
 
     Parser::Parser(std::shared_ptr<CANBusManager> busManager)
-        : _busManager(busManager) {
+        : _busManager(busManager), _threadCount(0) {
 
         auto nodeLineParserPtr = std::make_shared<NodeLineParser>();
         auto ignoreLineParserPtr = std::make_shared<IgnoreLineParser>();
         auto messageLineParserPtr = std::make_shared<MessageLineParser>();
         auto extraMessageLineParser = std::make_shared<ExtraMessageLineParser>();
         auto signalLineParser = std::make_shared <SignalLineParser>();
+        auto signalValueTypeLineParser = std::make_shared<SignalValueTypeLineParser>();
+        auto signalMultiplexerValueLineParser = std::make_shared<SignalMultiplexerValueLineParser>();
+
+        addLineParser("BU_", std::move(nodeLineParserPtr));
+        addLineParser("BO_", std::move(messageLineParserPtr));
+        addLineParser("BO_TX_BU_", std::move(extraMessageLineParser));
+        addLineParser("SG_", std::move(signalLineParser));
+        addLineParser("SIG_VALTYPE_", std::move(signalValueTypeLineParser));
+        addLineParser("SG_MUL_VAL_", std::move(signalMultiplexerValueLineParser));
 
-        _vLineParsers.push_back(std::move(nodeLineParserPtr));
-        _vLineParsers.push_back(std::move(ignoreLineParserPtr));
-        _vLineParsers.push_back(std::move(messageLineParserPtr));
-        _vLineParsers.push_back(std::move(extraMessageLineParser));
-        _vLineParsers.push_back(std::move(signalLineParser));
+        // Sections of the DBC format that are not loaded
+        for (const char* keyword : { "VERSION", "NS_", "NS_DESC_", "BS_", "CM_", "BA_DEF_", "BA_", "VAL_", "CAT_DEF_", "CAT_", "FILTER", "BA_DEF_DEF_",
+                 "EV_DATA_", "ENVVAR_DATA_", "EV_", "SGTYPE_", "SGTYPE_VAL_", "BA_DEF_SGTYPE_", "BA_SGTYPE_", "SIG_TYPE_REF_", "VAL_TABLE_", "SIG_GROUP_",
+                 "SIGTYPE_VALTYPE_", "BA_DEF_REL_", "BA_REL_", "BA_DEF_DEF_REL_", "BU_SG_REL_", "BU_EV_REL_", "BU_BO_REL_" }) {
+            addLineParser(keyword, ignoreLineParserPtr);
+        }
+    }
+
+    void Parser::addLineParser(const std::string& keyword, std::shared_ptr<ILineParser> lineParser) {
+        _lineParsers[keyword] = std::move(lineParser);
+    }
+
+    void Parser::setThreadCount(unsigned int threadCount) {
+        _threadCount = threadCount;
+    }
+
+    std::string_view Parser::getKeyword(std::string_view line) {
+        size_t start = 0;
+        while (start < line.size() && std::isspace(static_cast<unsigned char>(line[start]))) {
+            ++start;
+        }
+
+        size_t end = start;
+        while (end < line.size() && (std::isalnum(static_cast<unsigned char>(line[end])) || line[end] == '_')) {
+            ++end;
+        }
+        return line.substr(start, end - start);
     }
 
     bool Parser::loadDBC(const std::string& fileDir) {
-        std::ifstream file(fileDir);
+        DbcReader reader(fileDir);
         Logger& logger = Logger::getInstance();
 
-        if (!file.is_open()) {
+        if (!reader.isOpen()) {
             logger.log("Error: Could not open file " + fileDir, Logger::LOG_DEBUG);
             return false;
         }
@@ -47,27 +164,189 @@ namespace cantools_cpp
         std::string busName = std::filesystem::path(fileDir).stem().string();
         _busManager->createBus(busName);
 
-        std::string line;
-        while (std::getline(file, line)) {
-            // Check if the line is empty or contains only whitespace
-            if (line.empty() || std::all_of(line.begin(), line.end(), isspace)) {
-                continue;
-            }
+        // Runs of message statements are collected and parsed at once; they stay valid as long as the mapping
+        unsigned int threadCount = _threadCount > 0 ? _threadCount : std::thread::hardware_concurrency();
+        bool parallel = reader.isMapped() && threadCount > 1;
+        std::vector<std::string_view> messageSection;
 
+        // Statements are views into the file, blank lines are skipped by the reader
+        std::string_view line;
+        while (reader.next(line)) {
             // Process each valid line
-            logger.log("Read line: " + line, Logger::LOG_DEBUG);
+            if (logger.isEnabled(Logger::LOG_DEBUG)) {
+                logger.log("Read line: " + std::string(line), Logger::LOG_DEBUG);
+            }
 
-            for (auto parser : _vLineParsers) {
-                if (parser->tryParse(line, _busManager, busName)) {
-                    break;
-                }
+            // Only the parser of the keyword sees the line; lines of unknown keywords (e.g. continuation lines) are skipped
+            std::string_view keyword = getKeyword(line);
+            auto lineParser = _lineParsers.find(keyword);
+
+            if (parallel && (keyword == "BO_" || (!messageSection.empty() && (keyword == "SG_" || lineParser == _lineParsers.end())))) {
+                messageSection.push_back(line);
+                continue;
+            }
+            if (!messageSection.empty()) {
+                parseMessageSection(messageSection, busName, threadCount);
+                messageSection.clear();
+            }
+
+            if (lineParser != _lineParsers.end()) {
+                lineParser->second->tryParse(line, _busManager, busName);
             }
         }
+        if (!messageSection.empty()) {
+            parseMessageSection(messageSection, busName, threadCount);
+        }
 
         _busManager->getBus(busName)->build();
 
-        file.close();
         logger.log("Finished loading database from " + fileDir, Logger::LOG_DEBUG);
         return true;
     }
-}
\ No newline at end of file
+
+    void Parser::parseMessageSection(const std::vector<std::string_view>& statements, const std::string& busName, unsigned int threadCount) {
+        auto parse = [this, &busName](std::string_view statement, const std::shared_ptr<CANBusManager>& busManager) {
+            auto lineParser = _lineParsers.find(getKeyword(statement));
+            if (lineParser != _lineParsers.end()) {
+                lineParser->second->tryParse(statement, busManager, busName);
+            }
+        };
+
+        if (statements.size() < ParallelStatements) {
+            for (std::string_view statement : statements) {
+                parse(statement, _busManager);
+            }
+            return;
+        }
+
+        // Chunks start on a BO_ statement, so that each SG_ is parsed with its message
+        std::vector<size_t> bounds{ 0 };
+        for (size_t next = ChunkStatements; next < statements.size(); next += ChunkStatements) {
+            while (next < statements.size() && getKeyword(statements[next]) != "BO_") {
+                ++next;
+            }
+            if (next < statements.size()) {
+                bounds.push_back(next);
+            }
+        }
+        bounds.push_back(statements.size());
+
+        // Worker threads parse the chunks while this thread merges them in file order, as soon as each one is parsed
+        size_t chunkCount = bounds.size() - 1;
+        std::vector<std::shared_ptr<ChunkBusManager>> chunks(chunkCount);
+        std::vector<std::exception_ptr> errors(chunkCount);
+        std::vector<bool> parsed(chunkCount, false);
+        std::atomic<size_t> nextChunk(0);
+        std::mutex mutex;
+        std::condition_variable chunkParsed;
+
+        auto work = [&]() {
+            for (size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+                std::shared_ptr<ChunkBusManager> busManager;
+                std::exception_ptr error;
+                try {
+                    busManager = std::make_shared<ChunkBusManager>(busName, _busManager->getStringPool());
+                    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; ++i) {
+                        parse(statements[i], busManager);
+                    }
+                }
+                catch (...) {
+                    error = std::current_exception();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    chunks[chunk] = std::move(busManager);
+                    errors[chunk] = error;
+                    parsed[chunk] = true;
+                }
+                chunkParsed.notify_all();
+            }
+        };
+
+        // Joins the workers however the merge is left: a thread that cannot be created or a replay that throws must not
+        // destroy joinable threads, which calls std::terminate; the workers then stop after their current chunk
+        struct WorkerJoiner {
+            std::vector<std::thread>& workers;
+            std::atomic<size_t>& nextChunk;
+            size_t chunkCount;
+
+            ~WorkerJoiner() {
+                nextChunk = chunkCount;
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        WorkerJoiner joiner{ workers, nextChunk, chunkCount };
+        for (size_t i = 0; i < std::min<size_t>(threadCount - 1, chunkCount); ++i) {
+            workers.emplace_back(work);
+        }
+
+        auto bus = _busManager->getBus(busName);
+        std::exception_ptr error;
+        for (size_t chunk = 0; chunk < chunkCount && !error; ++chunk) {
+            std::shared_ptr<ChunkBusManager> busManager;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                chunkParsed.wait(lock, [&]() { return parsed[chunk]; });
+                busManager = std::move(chunks[chunk]);
+                error = errors[chunk];
+            }
+            if (error) {
+                // Let the workers run out of chunks
+                nextChunk = chunkCount;
+            }
+            else {
+                busManager->getChunkBus().replay(*bus);
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::shared_ptr<const CompiledDatabase> Parser::loadCompiledDBC(const std::string& fileDir) {
+        if (!loadDBC(fileDir)) {
+            return nullptr;
+        }
+
+        std::string busName = std::filesystem::path(fileDir).stem().string();
+        return CompiledDatabase::compile(*_busManager->getBus(busName));
+    }
+
+    bool Parser::loadCachedDBC(const std::string& fileDir, const std::string& cacheFile) {
+        std::string cachePath = cacheFile.empty() ? fileDir + ".cache" : cacheFile;
+        std::string busName = std::filesystem::path(fileDir).stem().string();
+        uint64_t sourceHash = 0;
+        uint64_t sourceSize = 0;
+
+        if (!hashSource(fileDir, sourceHash, sourceSize)) {
+            Logger::getInstance().log("Error: Could not open file " + fileDir, Logger::LOG_DEBUG);
+            return false;
+        }
+
+        if (DatabaseCache::load(cachePath, sourceHash, sourceSize, _busManager, busName)) {
+            Logger::getInstance().log("Loaded database cache " + cachePath, Logger::LOG_DEBUG);
+            return true;
+        }
+
+        if (!loadDBC(fileDir)) {
+            return false;
+        }
+
+        // loadDBC reads the file again: if it changed in between, the bus may not be the one of the hashed content and
+        // must not be cached under its hash. A cache that is not written only costs the next load a parse
+        uint64_t parsedHash = 0;
+        uint64_t parsedSize = 0;
+        if (!hashSource(fileDir, parsedHash, parsedSize) || parsedHash != sourceHash || parsedSize != sourceSize) {
+            Logger::getInstance().log("Warning: " + fileDir + " changed while it was loaded, database cache not written", Logger::LOG_WARNING);
+            return true;
+        }
+        DatabaseCache::write(*_busManager->getBus(busName), cachePath, sourceHash, sourceSize);
+        return true;
+    }
+}
@@ -10,21 +10,46 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <string_view>
+#include <vector>
 #include "CANBusManager.hpp"
 #include "ILineParser.hpp"
+#include "CompiledDatabase.hpp"
 
 namespace cantools_cpp {
     class Parser {
     private:
         std::shared_ptr<CANBusManager> _busManager; // Use unique_ptr for CANBusManager
-        std::vector<std::shared_ptr<ILineParser>> _vLineParsers;
+        std::map<std::string, std::shared_ptr<ILineParser>, std::less<>> _lineParsers; // Line parser of each DBC keyword
+        unsigned int _threadCount; // Number of threads parsing the messages, 0 for one per hardware thread
+
+        // Method to parse a run of message statements (BO_ and their SG_) of a mapped file, on several threads when it is large enough
+        void parseMessageSection(const std::vector<std::string_view>& statements, const std::string& busName, unsigned int threadCount);
 
     public:
         // Constructor that takes CANBusManager as a unique_ptr
         Parser(std::shared_ptr<CANBusManager> busManager);
 
-        // Method to load data from the file line by line
+        // Method to register the parser of the lines starting with a DBC keyword (BO_, SG_, ...), replacing any previous one
+        void addLineParser(const std::string& keyword, std::shared_ptr<ILineParser> lineParser);
+
+        // Method to set the number of threads parsing the messages of large files: 1 parses on the calling thread only,
+        // 0 (the default) uses one thread per hardware thread
+        void setThreadCount(unsigned int threadCount);
+
+        // Method to extract the DBC keyword of a line: the word after the leading whitespace, e.g. "BU_" for "BU_: ECU"
+        static std::string_view getKeyword(std::string_view line);
+
+        // Method to load data from the file statement by statement, reading it through a memory mapping
         bool loadDBC(const std::string& fileDir);
+
+        // Method to load a DBC file and compile its bus into an immutable database, nullptr if the file cannot be read
+        std::shared_ptr<const CompiledDatabase> loadCompiledDBC(const std::string& fileDir);
+
+        // Method to load a DBC file from its binary cache when the cache matches the file content, otherwise parsing the
+        // file and writing the cache for the next load; the cache defaults to the DBC path with a ".cache" suffix
+        bool loadCachedDBC(const std::string& fileDir, const std::string& cacheFile = std::string());
     };
 }
\ No newline at end of file
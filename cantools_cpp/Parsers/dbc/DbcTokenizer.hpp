@@ -0,0 +1,235 @@
+/**
+ * @file DbcTokenizer.hpp
+ * @brief Declaration of the DbcTokenizer class, a cursor over one DBC line used by the line parsers.
+ *
+ * The line parsers read their fields with a DbcTokenizer instead of std::regex: it walks the line once,
+ * left to right, and returns the fields as std::string_view into the line, so that a line is parsed
+ * without copies nor allocations. Each read consumes its token and returns false, without consuming
+ * anything, when the next characters do not form one.
+ *
+ * Character classes are the ASCII ones of the former regular expressions: \s, \d and \w.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include "Logger.hpp"
+
+namespace cantools_cpp
+{
+    class DbcTokenizer {
+    public:
+        /**
+         * @brief Creates a tokenizer at the start of a line.
+         *
+         * @param text The line, which must outlive the tokenizer and the views it returns.
+         */
+        explicit DbcTokenizer(std::string_view text) : _text(text), _position(0) {}
+
+        static bool isSpace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+        static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+        static bool isIdentifierStart(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; }
+        static bool isWordChar(char c) { return isIdentifierStart(c) || isDigit(c); }
+
+        /**
+         * @brief Indicates whether the whole line was consumed.
+         */
+        bool atEnd() const { return _position == _text.size(); }
+
+        /**
+         * @brief Retrieves the next character without consuming it, '\0' at the end of the line.
+         */
+        char peek() const { return atEnd() ? '\0' : _text[_position]; }
+
+        /**
+         * @brief Retrieves the position of the cursor in the line.
+         */
+        size_t position() const { return _position; }
+
+        /**
+         * @brief Retrieves the part of the line between a previous position and the cursor.
+         */
+        std::string_view since(size_t position) const { return _text.substr(position, _position - position); }
+
+        /**
+         * @brief Retrieves the part of the line that is left.
+         */
+        std::string_view rest() const { return _text.substr(_position); }
+
+        /**
+         * @brief Skips whitespace.
+         *
+         * @return The number of characters skipped; required separators check that it is not 0.
+         */
+        size_t skipSpace() {
+            size_t start = _position;
+            while (!atEnd() && isSpace(_text[_position])) {
+                ++_position;
+            }
+            return _position - start;
+        }
+
+        /**
+         * @brief Consumes a given character.
+         */
+        bool expect(char c) {
+            if (atEnd() || _text[_position] != c) {
+                return false;
+            }
+            ++_position;
+            return true;
+        }
+
+        /**
+         * @brief Consumes a given keyword or punctuation.
+         */
+        bool expect(std::string_view literal) {
+            if (_text.compare(_position, literal.size(), literal) != 0) {
+                return false;
+            }
+            _position += literal.size();
+            return true;
+        }
+
+        /**
+         * @brief Consumes the longest run of characters satisfying a predicate.
+         *
+         * @return The run, possibly empty.
+         */
+        template <typename Predicate>
+        std::string_view readWhile(Predicate predicate) {
+            size_t start = _position;
+            while (!atEnd() && predicate(_text[_position])) {
+                ++_position;
+            }
+            return since(start);
+        }
+
+        /**
+         * @brief Consumes an identifier: [a-zA-Z_]\w*
+         */
+        bool readIdentifier(std::string_view& identifier) {
+            if (!isIdentifierStart(peek())) {
+                return false;
+            }
+            identifier = readWhile(isWordChar);
+            return true;
+        }
+
+        /**
+         * @brief Consumes a word: \w+
+         */
+        bool readWord(std::string_view& word) {
+            word = readWhile(isWordChar);
+            return !word.empty();
+        }
+
+        /**
+         * @brief Consumes a decimal unsigned integer: \d+
+         *
+         * @return false if there are no digits or the value does not fit.
+         */
+        template <typename T>
+        bool readUnsigned(T& value) {
+            size_t start = _position;
+            std::string_view digits = readWhile(isDigit);
+            if (digits.empty() || std::from_chars(digits.data(), digits.data() + digits.size(), value).ec != std::errc()) {
+                _position = start;
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Consumes a number made of [\d+-eE.] and converts its longest valid prefix, as std::stof did.
+         *
+         * The conversion does not depend on the locale of the process. Numbers beyond the range of a float,
+         * such as the 1.79769313486232E+308 limits written by tools working with doubles, saturate to
+         * -FLT_MAX or FLT_MAX, and those too small for one to 0, with a warning.
+         */
+        bool readNumber(float& value) {
+            size_t start = _position;
+            std::string_view number = readWhile([](char c) { return isDigit(c) || c == '+' || c == '-' || c == 'e' || c == 'E' || c == '.'; });
+
+            // from_chars takes no explicit plus sign
+            const char* first = number.data();
+            const char* last = number.data() + number.size();
+            if (first != last && *first == '+') {
+                ++first;
+            }
+            std::from_chars_result result{ first, std::errc::invalid_argument };
+            if (!number.empty()) {
+                result = std::from_chars(first, last, value);
+            }
+            if (result.ec == std::errc::result_out_of_range) {
+                bool negative = *first == '-';
+                value = isTiny(std::string_view(first, static_cast<size_t>(result.ptr - first))) ? (negative ? -0.0f : 0.0f) : (negative ? -FLT_MAX : FLT_MAX);
+                Logger::getInstance().log("Warning: " + std::string(number) + " is out of the range of a float, read as " + std::to_string(value),
+                    Logger::LOG_WARNING);
+            }
+            else if (result.ec != std::errc()) {
+                _position = start;
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Consumes a quoted string: "[^"]*"
+         *
+         * @param content The characters between the quotes.
+         */
+        bool readQuoted(std::string_view& content) {
+            if (peek() != '"') {
+                return false;
+            }
+            size_t close = _text.find('"', _position + 1);
+            if (close == std::string_view::npos) {
+                return false;
+            }
+            content = _text.substr(_position + 1, close - _position - 1);
+            _position = close + 1;
+            return true;
+        }
+
+    private:
+        /**
+         * @brief Indicates whether a number out of the range of a float is too small rather than too large.
+         *
+         * @param number The number matched by from_chars, e.g. 0.5e-60 or -1.8E+308.
+         * @return true if its decimal exponent is negative.
+         */
+        static bool isTiny(std::string_view number) {
+            size_t mark = number.find_first_of("eE");
+            std::string_view mantissa = number.substr(0, mark);
+            std::string_view exponentText = mark == std::string_view::npos ? std::string_view() : number.substr(mark + 1);
+
+            // Decimal exponent of the first significant digit of the mantissa
+            size_t point = std::min(mantissa.find('.'), mantissa.size());
+            size_t digit = mantissa.find_first_of("123456789");
+            long long exponent = digit < point ? static_cast<long long>(point - digit) - 1 : static_cast<long long>(point) - static_cast<long long>(digit);
+
+            bool negativeExponent = !exponentText.empty() && exponentText[0] == '-';
+            if (!exponentText.empty() && (exponentText[0] == '-' || exponentText[0] == '+')) {
+                exponentText.remove_prefix(1);
+            }
+            long long explicitExponent = 0;
+            if (std::from_chars(exponentText.data(), exponentText.data() + exponentText.size(), explicitExponent).ec == std::errc::result_out_of_range) {
+                return negativeExponent;
+            }
+            return exponent + (negativeExponent ? -explicitExponent : explicitExponent) < 0;
+        }
+
+        std::string_view _text;  ///< The line.
+        size_t _position;        ///< Position of the next character to read.
+    };
+}
@@ -1,53 +1,73 @@
 // ExtraMessageLineParser.cpp
 #include <iostream>
-#include <sstream>
 #include "ExtraMessageLineParser.hpp"
+#include "DbcTokenizer.hpp"
 #include "CANBus.hpp"
+#include "Logger.hpp"
 
 namespace cantools_cpp
 {
+    namespace
+    {
+        std::vector<std::string> splitTransmitters(std::string_view transmitters) {
+            std::vector<std::string> result;
 
-    // Static members initialization
-    const std::string ExtraMessageLineParser::ExtraMessageTransmitterLineStarter = "BO_TX_BU_ ";
-    const std::regex ExtraMessageLineParser::ExtraTransmitterRegex(
-        R"(BO_TX_BU_ (\d+)\s*:\s*((\s*(?:[a-zA-Z_][\w]*)\s*(?:,)?)+);)");
-
-    std::vector<std::string> splitTransmitters(const std::string& transmitters) {
-        std::vector<std::string> result;
-        std::stringstream ss(transmitters);
-        std::string item;
-
-        while (std::getline(ss, item, ',')) {
-            // Trim spaces from the beginning and end of the item
-            auto start = item.find_first_not_of(" \t\n\r\f\v");
-            auto end = item.find_last_not_of(" \t\n\r\f\v");
-            if (start != std::string::npos) {
-                item = item.substr(start, (end - start + 1));
+            while (!transmitters.empty()) {
+                size_t comma = transmitters.find(',');
+                std::string_view item = transmitters.substr(0, comma);
+                transmitters = comma == std::string_view::npos ? std::string_view() : transmitters.substr(comma + 1);
+
+                // Trim spaces from the beginning and end of the item
+                auto start = item.find_first_not_of(" \t\n\r\f\v");
+                auto end = item.find_last_not_of(" \t\n\r\f\v");
+                if (start != std::string_view::npos) {
+                    item = item.substr(start, (end - start + 1));
+                }
+                result.emplace_back(item);
             }
-            result.push_back(item);
-        }
 
-        return result;
+            return result;
+        }
     }
 
-    bool ExtraMessageLineParser::tryParse(const std::string& line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) {
-        std::string _trimmed = line;
-        _trimmed.erase(0, _trimmed.find_first_not_of(" \t\n\r\f\v")); // Left trim
+    // Static members initialization
+    const std::string ExtraMessageLineParser::ExtraMessageTransmitterLineStarter = "BO_TX_BU_ ";
+
+    // BO_TX_BU_ <id> : <transmitter>, <transmitter> ... ;
+    bool ExtraMessageLineParser::tryParse(std::string_view line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) {
+        DbcTokenizer tokens(line);
+        tokens.skipSpace();
 
-        if (_trimmed.substr(0, ExtraMessageTransmitterLineStarter.length()) != ExtraMessageTransmitterLineStarter)
+        if (!tokens.expect(ExtraMessageTransmitterLineStarter))
+            return false;
+
+        uint32_t messageId = 0;
+        if (!tokens.readUnsigned(messageId))
+            return false;
+        tokens.skipSpace();
+        if (!tokens.expect(':'))
             return false;
+        tokens.skipSpace();
 
-        std::smatch _match;
-        if (std::regex_search(_trimmed, _match, ExtraTransmitterRegex) && _match.size() > 2) {
-            uint32_t messageId = std::stoul(_match.str(1));
-            std::string transmitters = _match.str(2);
+        // Transmitters separated by whitespace or commas, up to the semicolon
+        size_t listStart = tokens.position();
+        do {
+            std::string_view transmitter;
+            tokens.skipSpace();
+            if (!tokens.readIdentifier(transmitter))
+                return false;
+            tokens.skipSpace();
+            tokens.expect(',');
+        } while (tokens.peek() != ';');
+        std::string_view transmitters = tokens.since(listStart);
 
-            // Assuming processTransmitters is a method in CANBusManager to handle the list of transmitters for a message
-            busMan->getBus(busName)->getMessageById(messageId)->setAdditionalTransmitters(splitTransmitters(transmitters));
+        auto message = busMan->getBus(busName)->getMessageById(messageId);
+        if (!message) {
+            Logger::getInstance().log("BO_TX_BU_ refers to unknown message " + std::to_string(messageId), Logger::LOG_ERROR);
             return true;
         }
 
-        // If regex match fails or is incorrect, handle accordingly
-        return false;
+        message->setAdditionalTransmitters(splitTransmitters(transmitters));
+        return true;
     }
-}
\ No newline at end of file
+}
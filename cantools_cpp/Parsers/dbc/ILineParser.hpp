@@ -1,6 +1,7 @@
 // ILineParser.hpp
 #pragma once
 #include <string>
+#include <string_view>
 #include <memory>
 
 namespace cantools_cpp
@@ -13,6 +14,6 @@ namespace cantools_cpp
         virtual ~ILineParser() = default;
 
         // Pure virtual function equivalent to an interface method
-        virtual bool tryParse(const std::string& line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) = 0;
+        virtual bool tryParse(std::string_view line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) = 0;
     };
 }
\ No newline at end of file
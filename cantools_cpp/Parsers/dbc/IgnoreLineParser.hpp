@@ -13,7 +13,7 @@ namespace cantools_cpp
         IgnoreLineParser() = default;
 
         // Overriding the tryParse function
-        virtual bool tryParse(const std::string& line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) override;
+        virtual bool tryParse(std::string_view line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) override;
     };
 
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "MessageLineParser.hpp"
+#include "DbcTokenizer.hpp"
 #include "CANMessage.hpp"
 #include "CANBus.hpp"
 
@@ -7,34 +8,37 @@ namespace cantools_cpp
 
     // Static members initialization
     const std::string MessageLineParser::MessageLineStarter = "BO_ ";
-    const std::regex MessageLineParser::MessageRegex(
-        R"(BO_ (\d+)\s+([a-zA-Z_]\w*)\s*:\s*(\d+)\s+([a-zA-Z_]\w*))");
 
-    bool MessageLineParser::tryParse(const std::string& line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) {
-        std::string _trimmed = line; // Copy line to trim it
-        _trimmed.erase(0, _trimmed.find_first_not_of(" \t\n\r\f\v")); // Left trim
+    // BO_ <id> <name> : <length> <transmitter>
+    bool MessageLineParser::tryParse(std::string_view line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) {
+        DbcTokenizer tokens(line);
+        tokens.skipSpace();
 
-        if (_trimmed.substr(0, MessageLineStarter.length()) != MessageLineStarter)
+        if (!tokens.expect(MessageLineStarter))
             return false;
 
-        std::smatch _match;
-        if (std::regex_search(_trimmed, _match, MessageRegex) && _match.size() > 4) {
-            std::shared_ptr<CANMessage> msg = std::make_shared<CANMessage>(static_cast<unsigned int>(std::stoul(_match.str(1))));
-            msg->setName(_match.str(2));  // Use setter for the name
-            msg->setLength(static_cast<unsigned short>(std::stoi(_match.str(3)))); // Use setter for DLC, parsing the size
-            msg->setTransmitter(_match.str(4)); // Use setter for the transmitter
+        uint64_t id = 0;
+        int length = 0;
+        std::string_view name;
+        std::string_view transmitter;
 
-            auto canNode = busMan->getBus(busName)->getNodeByName(msg->getTransmitter());
+        if (!tokens.readUnsigned(id) || !tokens.skipSpace() || !tokens.readIdentifier(name))
+            return false;
+        tokens.skipSpace();
+        if (!tokens.expect(':'))
+            return false;
+        tokens.skipSpace();
+        if (!tokens.readUnsigned(length) || !tokens.skipSpace() || !tokens.readIdentifier(transmitter))
+            return false;
 
-            if (canNode)
-            {
-                canNode->addMessage(msg);
-            }
+        auto bus = busMan->getBus(busName);
+        std::shared_ptr<CANMessage> msg = bus->create<CANMessage>(static_cast<uint32_t>(id), busMan->getStringPool(), bus->getArena().get());
+        msg->setName(std::string(name));  // Use setter for the name
+        msg->setLength(static_cast<unsigned short>(length)); // Use setter for DLC, parsing the size
+        msg->setTransmitter(std::string(transmitter)); // Use setter for the transmitter
 
-            return true;
-        }
+        bus->addTransmittedMessage(msg);
 
-        // Implement failure notification logic here if needed
-        return false;
+        return true;
     }
-}
\ No newline at end of file
+}
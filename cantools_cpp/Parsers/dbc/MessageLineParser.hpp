@@ -1,6 +1,5 @@
 // MessageLineParser.hpp
 #pragma once
-#include <regex>
 #include <string>
 #include <memory>
 #include "ILineParser.hpp"
@@ -12,14 +11,13 @@ namespace cantools_cpp
     class MessageLineParser : public ILineParser {
     private:
         static const std::string MessageLineStarter;
-        static const std::regex MessageRegex;
 
     public:
         // Constructor
         MessageLineParser() = default;
 
         // Overriding the tryParse function
-        virtual bool tryParse(const std::string& line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) override;
+        virtual bool tryParse(std::string_view line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) override;
     };
 
 }
\ No newline at end of file
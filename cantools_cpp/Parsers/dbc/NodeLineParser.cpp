@@ -1,7 +1,8 @@
 // NodeLineParser.cpp
 #include <iostream>
-#include <sstream>
+#include <vector>
 #include "NodeLineParser.hpp"
+#include "DbcTokenizer.hpp"
 #include "CANBus.hpp"
 
 namespace cantools_cpp
@@ -10,10 +11,10 @@ namespace cantools_cpp
     const std::string NodeLineParser::NameGroup = "Name";
 
     // Constructor
-    NodeLineParser::NodeLineParser()
-        : _regex(R"(BU_:\s*((?:\s+[a-zA-Z_][\w]*\s*)+))") {}
+    NodeLineParser::NodeLineParser() {}
 
-    bool NodeLineParser::tryParse(const std::string& line, std::shared_ptr<CANBusManager> busManager, const std::string& busName) {
+    // BU_: <node> <node> ...
+    bool NodeLineParser::tryParse(std::string_view line, std::shared_ptr<CANBusManager> busManager, const std::string& busName) {
         // Check if the line starts with "BU_:"
         if (line.find(NodeLineStarter) != 0)
             return false;
@@ -22,16 +23,22 @@ namespace cantools_cpp
         if (line == NodeLineStarter)
             return true;
 
-        // Attempt to match the regex
-        std::smatch match;
-        if (std::regex_match(line, match, _regex)) {
-            // Extract the matched node names
-            std::istringstream nodeStream(match.str(1));
-            std::string nodeName;
+        // Node names separated by whitespace, with whitespace before the first one
+        DbcTokenizer tokens(line.substr(std::char_traits<char>::length(NodeLineStarter)));
+        std::vector<std::string_view> nodeNames;
+        bool valid = tokens.skipSpace() > 0;
+        while (valid && !tokens.atEnd()) {
+            std::string_view nodeName;
+            valid = tokens.readIdentifier(nodeName) && (tokens.skipSpace() > 0 || tokens.atEnd());
+            nodeNames.push_back(nodeName);
+        }
+
+        if (valid && !nodeNames.empty()) {
+            auto bus = busManager->getBus(busName);
 
-            while (nodeStream >> nodeName) {
+            for (std::string_view nodeName : nodeNames) {
                 // Add each node name to the CANBusManager
-                std::shared_ptr<CANNode> node = std::make_shared<CANNode>(nodeName, busName, *busManager.get());
+                std::shared_ptr<CANNode> node = bus->create<CANNode>(std::string(nodeName), busName, *busManager.get());
                 node->attachToBus();
             }
         }
@@ -42,4 +49,4 @@ namespace cantools_cpp
 
         return true;
     }
-}
\ No newline at end of file
+}
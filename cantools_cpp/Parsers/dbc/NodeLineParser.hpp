@@ -1,7 +1,6 @@
 // NodeLineParser.hpp
 #pragma once
 #include <string>
-#include <regex>
 #include <memory>
 #include "ILineParser.hpp"
 #include "CANBusManager.hpp"
@@ -12,10 +11,9 @@ namespace cantools_cpp
     private:
         static constexpr const char* NodeLineStarter = "BU_:";
         static const std::string NameGroup;
-        std::regex _regex;
 
     public:
         NodeLineParser();
-        virtual bool tryParse(const std::string& line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) override;
+        virtual bool tryParse(std::string_view line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) override;
     };
 }
\ No newline at end of file
@@ -1,45 +1,111 @@
 #include <sstream>
 #include "SignalLineParser.hpp"
+#include "DbcTokenizer.hpp"
 #include "CANBus.hpp"
 #include "Logger.hpp"
 
 namespace cantools_cpp
 {
-    const std::regex SignalLineParser::signalRegex(
-        R"regex(\s*SG_\s+([\w]+)\s*([Mm\d]*)\s*:\s*(\d+)\|(\d+)@([01])([+-])\s+\(([\d\+\-eE.]+),([\d\+\-eE.]+)\)\s+\[([\d\+\-eE.]+)\|([\d\+\-eE.]+)\]\s+"([^"]*)"\s+([\w\s,]+))regex"
-    );
+    namespace
+    {
+        bool isMultiplexerChar(char c) { return c == 'M' || c == 'm' || DbcTokenizer::isDigit(c); }
+        bool isReceiverChar(char c) { return DbcTokenizer::isWordChar(c) || DbcTokenizer::isSpace(c) || c == ','; }
+
+        // Multiplexer indicator: empty, "M", "m<value>" or "m<value>M", with a value that fits 64 bits
+        bool isMultiplexerIndicator(std::string_view multiplexer) {
+            if (multiplexer.empty() || multiplexer == "M")
+                return true;
+            if (multiplexer[0] != 'm')
+                return false;
+            DbcTokenizer tokens(multiplexer.substr(1));
+            uint64_t value = 0;
+            return tokens.readUnsigned(value) && (tokens.atEnd() || (tokens.expect('M') && tokens.atEnd()));
+        }
+    }
 
     SignalLineParser::SignalLineParser() {}
 
-    bool SignalLineParser::tryParse(const std::string& line, std::shared_ptr<CANBusManager> busManager, const std::string& busName)
+    // SG_ <name> [M|mN|mNM] : <start>|<length>@<order><sign> (<factor>,<offset>) [<min>|<max>] "<unit>" <receivers>
+    bool SignalLineParser::tryParse(std::string_view line, std::shared_ptr<CANBusManager> busManager, const std::string& busName)
+    {
+        if (!parse(line, busManager, busName)) {
+            if (Logger::getInstance().isEnabled(Logger::LOG_DEBUG)) {
+                Logger::getInstance().log("Syntax error in signal line: " + std::string(line), Logger::LOG_DEBUG);
+            }
+            return false;
+        }
+        return true;
+    }
+
+    bool SignalLineParser::parse(std::string_view line, const std::shared_ptr<CANBusManager>& busManager, const std::string& busName)
     {
-        std::smatch match;
-        if (!std::regex_match(line, match, signalRegex)) {
-            Logger::getInstance().log("Regex match failed for line: " + line, Logger::LOG_DEBUG);
+        DbcTokenizer tokens(line);
+        std::string_view name;
+        int startBit = 0;
+        int length = 0;
+        float factor = 0.0f;
+        float offset = 0.0f;
+        float minVal = 0.0f;
+        float maxVal = 0.0f;
+        std::string_view unit;
+
+        tokens.skipSpace();
+        if (!tokens.expect("SG_") || !tokens.skipSpace() || !tokens.readWord(name))
+            return false;
+        tokens.skipSpace();
+        std::string_view multiplexer = tokens.readWhile(isMultiplexerChar);
+        if (!isMultiplexerIndicator(multiplexer)) {
+            Logger::getInstance().log("Error: Invalid multiplexer indicator " + std::string(multiplexer) + " of signal " + std::string(name), Logger::LOG_ERROR);
+            return false;
+        }
+        tokens.skipSpace();
+        if (!tokens.expect(':'))
             return false;
+        tokens.skipSpace();
+
+        if (!tokens.readUnsigned(startBit) || !tokens.expect('|') || !tokens.readUnsigned(length) || !tokens.expect('@'))
+            return false;
+        char order = tokens.peek();
+        if ((order != '0' && order != '1') || !tokens.expect(order))
+            return false;
+        char sign = tokens.peek();
+        if ((sign != '+' && sign != '-') || !tokens.expect(sign))
+            return false;
+
+        if (!tokens.skipSpace() || !tokens.expect('(') || !tokens.readNumber(factor) || !tokens.expect(',') || !tokens.readNumber(offset) || !tokens.expect(')'))
+            return false;
+        if (!tokens.skipSpace() || !tokens.expect('[') || !tokens.readNumber(minVal) || !tokens.expect('|') || !tokens.readNumber(maxVal) || !tokens.expect(']'))
+            return false;
+        if (!tokens.skipSpace() || !tokens.readQuoted(unit))
+            return false;
+
+        // The receivers are the rest of the line; when only whitespace follows the unit, the last whitespace character
+        // is the receiver, as with the former regular expression
+        size_t separator = tokens.skipSpace();
+        if (separator == 0)
+            return false;
+        std::string_view receiver = tokens.readWhile(isReceiverChar);
+        if (!tokens.atEnd())
+            return false;
+        if (receiver.empty()) {
+            if (separator < 2)
+                return false;
+            receiver = tokens.since(tokens.position() - 1);
         }
 
-        // Extract signal components based on matched groups
-        auto name = match[1].str();
-        auto multiplexer = match[2].str();
-        auto startBit = static_cast<uint8_t>(std::stoi(match[3].str()));
-        auto length = static_cast<uint8_t>(std::stoi(match[4].str()));
-        auto byteOrder = static_cast<uint8_t>(std::stoi(match[5].str()));  // 0 = MSB, 1 = LSB
-        auto valueType = match[6].str() == "-" ? DbcValueType::Signed : DbcValueType::Unsigned;
-        auto factor = std::stof(match[7].str());
-        auto offset = std::stof(match[8].str());
-        auto minVal = std::stof(match[9].str());
-        auto maxVal = std::stof(match[10].str());
-        auto unit = match[11].str();
-        auto receiver = match[12].str(); // Can be multiple receivers
-
-        // Create the CANSignal and add it to the bus manager
-        auto signal = std::make_shared<CANSignal>(name, startBit, length, factor, offset, minVal, maxVal, unit, byteOrder, valueType, receiver, multiplexer);
-
-        // Add signal to the bus
-        busManager->getBus(busName)->addSignal(signal);
-
-        Logger::getInstance().log("Signal added: " + name, Logger::LOG_DEBUG);
+        auto byteOrder = static_cast<uint8_t>(order - '0');  // 0 = MSB, 1 = LSB
+        auto valueType = sign == '-' ? DbcValueType::Signed : DbcValueType::Unsigned;
+
+        // Create the CANSignal in the signal table and the arena of its bus and add it to the bus
+        auto bus = busManager->getBus(busName);
+        auto signal = bus->create<CANSignal>(std::string(name), static_cast<uint8_t>(startBit), static_cast<uint8_t>(length), factor, offset, minVal, maxVal,
+            std::string(unit), byteOrder, valueType, std::string(receiver), std::string(multiplexer), busManager->getStringPool(), bus->getSignalTable(),
+            bus->getArena().get());
+        bus->addSignal(signal);
+
+        if (Logger::getInstance().isEnabled(Logger::LOG_DEBUG)) {
+            Logger::getInstance().log("Signal added: " + signal->getName(), Logger::LOG_DEBUG);
+        }
         return true;
     }
 
@@ -50,4 +116,4 @@ namespace cantools_cpp
         iss >> test;
         return iss.eof() && !iss.fail();
     }
-}
\ No newline at end of file
+}
@@ -1,5 +1,4 @@
 #pragma once
-#include <regex>
 #include <string>
 #include <memory>
 #include "ILineParser.hpp"
@@ -13,12 +12,10 @@ namespace cantools_cpp
     public:
         SignalLineParser();
 
-        virtual bool tryParse(const std::string& line, std::shared_ptr<CANBusManager> busManager, const std::string& busName) override;
+        virtual bool tryParse(std::string_view line, std::shared_ptr<CANBusManager> busManager, const std::string& busName) override;
 
     private:
-        static const std::regex signalRegex;
+        bool parse(std::string_view line, const std::shared_ptr<CANBusManager>& busManager, const std::string& busName);
         static bool isInteger(const std::string& str);
     };
-
-    // Regex pattern is defined in the .cpp file
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include <string>
+#include <memory>
+#include "SignalMultiplexerValueLineParser.hpp"
+#include "DbcTokenizer.hpp"
+#include "Logger.hpp"
+#include "CANSignal.hpp"
+#include "CANBus.hpp"
+
+namespace cantools_cpp
+{
+    namespace
+    {
+        bool isRangeListChar(char c) { return DbcTokenizer::isDigit(c) || DbcTokenizer::isSpace(c) || c == ',' || c == '-'; }
+
+        // Collects the <low>-<high> ranges of a list, skipping whatever is not a range
+        std::vector<MultiplexerRange> parseRanges(std::string_view rangeList) {
+            std::vector<MultiplexerRange> values;
+
+            while (true) {
+                DbcTokenizer tokens(rangeList);
+                tokens.readWhile([](char c) { return !DbcTokenizer::isDigit(c); });
+
+                uint64_t low = 0;
+                uint64_t high = 0;
+                if (!tokens.readUnsigned(low))
+                    break;
+
+                // Digits that do not start a range are skipped
+                rangeList = tokens.rest();
+                tokens.skipSpace();
+                if (tokens.expect('-')) {
+                    tokens.skipSpace();
+                    if (tokens.readUnsigned(high)) {
+                        values.push_back({ low, high });
+                        rangeList = tokens.rest();
+                    }
+                }
+            }
+
+            return values;
+        }
+    }
+
+    SignalMultiplexerValueLineParser::SignalMultiplexerValueLineParser() {}
+
+    // SG_MUL_VAL_ <message id> <signal> <multiplexor> <low>-<high>, ...;
+    bool SignalMultiplexerValueLineParser::tryParse(std::string_view line, std::shared_ptr<CANBusManager> busManager, const std::string& busName) {
+        if (line.find("SG_MUL_VAL_ ") == std::string_view::npos)
+            return false;
+
+        DbcTokenizer tokens(line);
+        uint32_t messageId = 0;
+        std::string_view signalName;
+        std::string_view multiplexorName;
+
+        tokens.skipSpace();
+        bool valid = tokens.expect("SG_MUL_VAL_") && tokens.skipSpace() && tokens.readUnsigned(messageId) && tokens.skipSpace()
+            && tokens.readIdentifier(signalName) && tokens.skipSpace() && tokens.readIdentifier(multiplexorName);
+
+        // The list needs a whitespace before it and one character, possibly that whitespace
+        size_t separator = valid ? tokens.skipSpace() : 0;
+        std::string_view rangeList = tokens.readWhile(isRangeListChar);
+        valid = valid && separator > 0 && (!rangeList.empty() || separator > 1) && tokens.expect(';');
+        tokens.skipSpace();
+
+        if (!valid || !tokens.atEnd()) {
+            if (Logger::getInstance().isEnabled(Logger::LOG_DEBUG)) {
+                Logger::getInstance().log("Syntax error in multiplexer value line: " + std::string(line), Logger::LOG_DEBUG);
+            }
+            return false;
+        }
+
+        busManager->getBus(busName)->addSignalMultiplexerValues(messageId, std::string(signalName), std::string(multiplexorName), parseRanges(rangeList));
+        return true;
+    }
+}
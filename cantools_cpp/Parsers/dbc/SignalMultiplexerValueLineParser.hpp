@@ -0,0 +1,18 @@
+#pragma once
+#include <string>
+#include "ILineParser.hpp"
+#include "CANBusManager.hpp"  // This includes CAN message and signal multiplexing management
+
+namespace cantools_cpp
+{
+    /**
+     * @brief Parses the extended multiplexing lines: SG_MUL_VAL_ <message id> <signal> <multiplexor> <low>-<high>, ...;
+     */
+    class SignalMultiplexerValueLineParser : public ILineParser {
+    public:
+        SignalMultiplexerValueLineParser();
+        virtual ~SignalMultiplexerValueLineParser() = default;
+
+        virtual bool tryParse(std::string_view line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) override;
+    };
+}
@@ -0,0 +1,44 @@
+#include <string>
+#include <memory>
+#include "SignalValueTypeLineParser.hpp"
+#include "DbcTokenizer.hpp"
+#include "Logger.hpp"
+#include "CANSignal.hpp"
+#include "CANBus.hpp"
+
+namespace cantools_cpp
+{
+
+    SignalValueTypeLineParser::SignalValueTypeLineParser() {}
+
+    // SIG_VALTYPE_ <message id> <signal> : <0|1|2|3>;
+    bool SignalValueTypeLineParser::tryParse(std::string_view line, std::shared_ptr<CANBusManager> busManager, const std::string& busName) {
+        if (line.find("SIG_VALTYPE_ ") != 0)
+            return false;
+
+        DbcTokenizer tokens(line);
+        uint32_t messageId = 0;
+        std::string_view signalName;
+
+        tokens.expect("SIG_VALTYPE_");
+        if (!tokens.skipSpace() || !tokens.readUnsigned(messageId) || !tokens.skipSpace() || !tokens.readIdentifier(signalName))
+            return false;
+        tokens.skipSpace();
+        if (!tokens.expect(':'))
+            return false;
+        tokens.skipSpace();
+        char signalType = tokens.peek();
+        if (signalType < '0' || signalType > '3' || !tokens.expect(signalType))
+            return false;
+        tokens.skipSpace();
+        if (!tokens.expect(';') || !tokens.atEnd())
+            return false;
+
+        if (signalType == '1' || signalType == '2') {
+            DbcValueType valueType = (signalType == '1' ? IEEEFloat : IEEEDouble);
+            busManager->getBus(busName)->addSignalValueType(messageId, std::string(signalName), valueType);
+        }
+
+        return true;
+    }
+}
@@ -1,5 +1,4 @@
 #pragma once
-#include <regex>
 #include <string>
 #include "ILineParser.hpp"
 #include "CANBusManager.hpp"  // This includes CAN message and signal value type management
@@ -11,9 +10,6 @@ namespace cantools_cpp
         SignalValueTypeLineParser();
         virtual ~SignalValueTypeLineParser() = default;
 
-        virtual bool tryParse(const std::string& line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) override;
-
-    private:
-        static const std::regex signalValueTypeRegex;
+        virtual bool tryParse(std::string_view line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) override;
     };
 }
@@ -0,0 +1,143 @@
+/**
+ * @file BatchDecoderTest.cpp
+ * @brief Checks that BatchDecoder decodes the same raw and physical values as CANMessage::setData.
+ *
+ * Random frames of every message of the DBC files given on the command line are decoded with each SIMD
+ * level supported by the CPU, and compared with the values of the signals once each frame is set on the
+ * message; setData only decodes the multiplexed signals selected by their multiplexor, the other rows of
+ * their columns are not compared. Frame counts that are not multiples of the kernel widths exercise the scalar tail, a stride
+ * larger than the frame the gather of spaced frames; the buffer ends with the last frame, so that reads
+ * past it are caught by the sanitizers.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "BatchDecoder.hpp"
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+#include "CANSignal.hpp"
+#include "Parser.hpp"
+
+using namespace cantools_cpp;
+
+namespace
+{
+    constexpr int MaxReported = 20;
+
+    int failures = 0;
+    std::mt19937_64 engine(0xdec0);
+
+    void report(const std::string& what, const CANMessage& message, const std::string& signal, int level, size_t frameCount, size_t stride)
+    {
+        if (++failures <= MaxReported) {
+            std::cerr << what << " mismatch: message=" << message.getName() << " signal=" << signal << " simdLevel=" << level
+                << " frames=" << frameCount << " stride=" << stride << std::endl;
+        }
+    }
+
+    bool samePhysical(double a, double b)
+    {
+        return a == b || (a != a && b != b) || std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+
+    void checkFrames(CANMessage& message, BatchDecoder& decoder, size_t frameCount, size_t stride)
+    {
+        size_t length = static_cast<size_t>(message.getLength());
+        std::vector<uint8_t> payloads((frameCount - 1) * stride + length);
+        for (uint8_t& byte : payloads) {
+            byte = static_cast<uint8_t>(engine());
+        }
+
+        size_t signalCount = decoder.getSignalCount();
+        std::vector<std::vector<uint64_t>> raw(signalCount, std::vector<uint64_t>(frameCount));
+        std::vector<std::vector<double>> physical(signalCount, std::vector<double>(frameCount));
+        std::vector<uint64_t*> rawColumns;
+        std::vector<double*> physicalColumns;
+        for (size_t column = 0; column < signalCount; ++column) {
+            rawColumns.push_back(raw[column].data());
+            physicalColumns.push_back(physical[column].data());
+        }
+
+        // Expected values of each signal, frame by frame
+        std::vector<std::shared_ptr<CANSignal>> signals;
+        for (size_t column = 0; column < signalCount; ++column) {
+            signals.push_back(message.getSignal(decoder.getSignalName(column)).lock());
+        }
+        std::vector<std::vector<uint64_t>> expectedRaw(signalCount, std::vector<uint64_t>(frameCount));
+        std::vector<std::vector<double>> expectedPhysical(signalCount, std::vector<double>(frameCount));
+        std::vector<std::vector<bool>> active(signalCount, std::vector<bool>(frameCount));
+        for (size_t frame = 0; frame < frameCount; ++frame) {
+            message.setData(payloads.data() + frame * stride, message.getLength());
+            for (size_t column = 0; column < signalCount; ++column) {
+                active[column][frame] = signals[column]->isActive();
+                expectedRaw[column][frame] = signals[column]->getRawValue();
+                expectedPhysical[column][frame] = signals[column]->getPhysicalValue();
+            }
+        }
+
+        for (int level = SimdLevel_Scalar; level <= BatchDecoder::getBestSimdLevel(); ++level) {
+            decoder.setSimdLevel(static_cast<SimdLevel>(level));
+            decoder.decode(payloads.data(), frameCount, stride, rawColumns.data(), physicalColumns.data());
+            for (size_t column = 0; column < signalCount; ++column) {
+                for (size_t frame = 0; frame < frameCount; ++frame) {
+                    if (!active[column][frame]) {
+                        continue;
+                    }
+                    if (raw[column][frame] != expectedRaw[column][frame]) {
+                        report("raw", message, signals[column]->getName(), level, frameCount, stride);
+                        break;
+                    }
+                    if (!samePhysical(physical[column][frame], expectedPhysical[column][frame])) {
+                        report("physical", message, signals[column]->getName(), level, frameCount, stride);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    void checkMessage(CANMessage& message)
+    {
+        BatchDecoder decoder(message);
+        size_t length = static_cast<size_t>(message.getLength());
+        if (length == 0 || decoder.getSignalCount() == 0) {
+            return;
+        }
+        for (size_t frameCount : { 1, 2, 3, 5, 7, 9, 31, 258 }) {
+            checkFrames(message, decoder, frameCount, length);
+            checkFrames(message, decoder, frameCount, length + 5);
+            checkFrames(message, decoder, frameCount, 64);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i) {
+        auto busManager = std::make_shared<CANBusManager>();
+        Parser parser(busManager);
+        if (!parser.loadDBC(argv[i])) {
+            std::cerr << "Could not load " << argv[i] << std::endl;
+            ++failures;
+            continue;
+        }
+        for (const auto& message : busManager->getBuses().begin()->second->getAllMessages()) {
+            checkMessage(*message);
+        }
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " mismatches" << std::endl;
+        return 1;
+    }
+    std::cout << "BatchDecoder matches CANMessage::setData" << std::endl;
+    return 0;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file BitKernelTest.cpp
+ * @brief Checks the word-wide BitKernel against the legacy bit-by-bit extraction and encoding.
+ *
+ * Every start bit, every length from 1 to 64, both byte orders and every frame length from 1 to 64
+ * bytes are extracted from and inserted into random frames, and compared bit for bit with the
+ * reference path the library used before the kernel: mirror the frame for Motorola signals, convert
+ * the start bit with the getStartBitLE formula, and walk the bits one at a time.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "BitKernel.hpp"
+#include "CANSignal.hpp"
+#include "Util.hpp"
+
+using namespace cantools_cpp;
+
+namespace
+{
+    constexpr int MaxFrameLength = 64;
+    constexpr int MaxLength = 64;
+    constexpr int MaxReported = 20;
+
+    int failures = 0;
+
+    void report(const char* what, int startBit, int length, bool motorola, int frameLength)
+    {
+        if (++failures <= MaxReported) {
+            std::cerr << what << " mismatch: startBit=" << startBit << " length=" << length
+                << " order=" << (motorola ? "motorola" : "intel") << " frameLength=" << frameLength << std::endl;
+        }
+    }
+
+    // Legacy Util::getStartBitLE, including its wrap around to uint16_t
+    uint16_t legacyStartBitLE(int startBit, int length, int frameLength)
+    {
+        uint16_t startByte = static_cast<uint16_t>(startBit / 8);
+        return static_cast<uint16_t>(8 * frameLength - length - (8 * startByte) - ((8 * (startByte + 1) - startBit - 1) % 8));
+    }
+
+    // Legacy Util::extractBits
+    uint64_t legacyExtractBits(const std::vector<uint8_t>& data, int startBit, int length)
+    {
+        uint64_t result = 0;
+        int bitIndex = 0;
+        for (int bitPos = startBit; bitPos < startBit + length; bitPos++) {
+            size_t bytePos = static_cast<size_t>(bitPos / 8);
+            if (bytePos >= data.size())
+                break;
+            if (data[bytePos] & (1 << (bitPos % 8))) {
+                result |= 1ULL << bitIndex;
+            }
+            bitIndex++;
+        }
+        return result;
+    }
+
+    // Legacy CANSignal::decode path
+    uint64_t legacyExtract(std::vector<uint8_t> frame, int startBit, int length, bool motorola)
+    {
+        int frameLength = static_cast<int>(frame.size());
+        if (motorola) {
+            std::reverse(frame.begin(), frame.end());
+            startBit = legacyStartBitLE(startBit, length, frameLength);
+        }
+        return legacyExtractBits(frame, startBit, length);
+    }
+
+    // Bit-by-bit counterpart of legacyExtract, writing the bits of the frame instead of reading them
+    void legacyInsert(std::vector<uint8_t>& frame, int startBit, int length, bool motorola, uint64_t value)
+    {
+        int frameLength = static_cast<int>(frame.size());
+        if (motorola) {
+            std::reverse(frame.begin(), frame.end());
+            startBit = legacyStartBitLE(startBit, length, frameLength);
+        }
+        for (int bit = 0; bit < length; ++bit) {
+            int bitPos = startBit + bit;
+            if (bitPos >= 8 * frameLength)
+                break;
+            uint8_t mask = static_cast<uint8_t>(1 << (bitPos % 8));
+            frame[bitPos / 8] = static_cast<uint8_t>((value >> bit) & 1 ? frame[bitPos / 8] | mask : frame[bitPos / 8] & ~mask);
+        }
+        if (motorola) {
+            std::reverse(frame.begin(), frame.end());
+        }
+    }
+
+    void checkStartBitLE()
+    {
+        // CANSignal stores its start bit on 8 bits
+        for (int startBit = 0; startBit < 256; ++startBit) {
+            for (int length = 1; length <= MaxLength; ++length) {
+                CANSignal signal("S", static_cast<uint8_t>(startBit), static_cast<uint8_t>(length), 1.0f, 0.0f, 0.0f, 0.0f, "", ByteOrder_MSB, 0, "", "");
+                for (int frameLength = 1; frameLength <= MaxFrameLength; ++frameLength) {
+                    if (Util::getInstance().getStartBitLE(signal, frameLength) != legacyStartBitLE(startBit, length, frameLength)) {
+                        report("getStartBitLE", startBit, length, true, frameLength);
+                    }
+                }
+            }
+        }
+    }
+
+    void checkKernel()
+    {
+        std::mt19937_64 random(0x5eed);
+        std::vector<uint8_t> frame;
+        std::vector<uint8_t> expected;
+        // The kernel reads and writes whole words, short frames are padded to 8 bytes
+        std::vector<uint8_t> buffer;
+
+        for (int frameLength = 1; frameLength <= MaxFrameLength; ++frameLength) {
+            size_t bufferLength = static_cast<size_t>(std::max(frameLength, 8));
+            frame.resize(static_cast<size_t>(frameLength));
+
+            for (int startBit = 0; startBit < 8 * frameLength; ++startBit) {
+                for (uint8_t& byte : frame) {
+                    byte = static_cast<uint8_t>(random());
+                }
+
+                for (int length = 1; length <= MaxLength; ++length) {
+                    for (bool motorola : { false, true }) {
+                        BitKernel::Window window = BitKernel::locate(startBit, length, motorola, frameLength);
+
+                        // The padding is filled with garbage which must neither be read nor modified
+                        buffer.assign(frame.begin(), frame.end());
+                        buffer.resize(bufferLength, 0xa5);
+
+                        if (BitKernel::extract(buffer.data(), window) != legacyExtract(frame, startBit, length, motorola)) {
+                            report("extract", startBit, length, motorola, frameLength);
+                        }
+                        if (!motorola && Util::getInstance().extractBits(frame, startBit, length) != legacyExtractBits(frame, startBit, length)) {
+                            report("extractBits", startBit, length, motorola, frameLength);
+                        }
+
+                        uint64_t value = random();
+                        expected = frame;
+                        legacyInsert(expected, startBit, length, motorola, value);
+                        BitKernel::insert(buffer.data(), window, value);
+
+                        if (!std::equal(expected.begin(), expected.end(), buffer.begin())
+                            || std::any_of(buffer.begin() + frameLength, buffer.end(), [](uint8_t byte) { return byte != 0xa5; })) {
+                            report("insert", startBit, length, motorola, frameLength);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int main()
+{
+    checkStartBitLE();
+    checkKernel();
+
+    if (failures > 0) {
+        std::cerr << failures << " mismatches" << std::endl;
+        return 1;
+    }
+    std::cout << "BitKernel matches the legacy extraction and encoding" << std::endl;
+    return 0;
+}
@@ -0,0 +1,238 @@
+/**
+ * @file CodegenTest.cpp
+ * @brief Checks the headers generated by cantools_codegen against the runtime model.
+ *
+ * The headers of every bundled DBC file are generated at build time and compiled in. For each message,
+ * random frames are decoded by the generated struct and by CANMessage, and random raw values are encoded
+ * by both, then decoded back; the raw values of the signals present and the frames have to agree. The
+ * generated physical accessors are checked against CANSignal: getPhysical_X() after each decode, and
+ * setPhysical_X() on values in range, on rounding ties, out of range, negative and not a number.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+#include "CANSignal.hpp"
+#include "Parser.hpp"
+#include "TestSupport.hpp"
+#include "CodegenBuses.hpp"
+
+using namespace cantools_cpp;
+using namespace cantools_cpp::test;
+
+namespace
+{
+    constexpr int Iterations = 200;
+    constexpr int MaxReported = 20;
+
+    int failures = 0;
+    std::mt19937_64 engine(0xc0de);
+
+    void report(const std::string& what, const CANMessage& message, const std::string& signal = "")
+    {
+        if (++failures <= MaxReported) {
+            std::cerr << what << " mismatch: message=" << message.getName() << (signal.empty() ? "" : " signal=" + signal) << std::endl;
+        }
+    }
+
+    // Compares the raw values of the signals present in the runtime message with the generated struct
+    template <typename Struct>
+    void compareSignals(const char* what, Struct& decoded, CANMessage& message)
+    {
+        decoded.visit([&](const char* name, auto& field) {
+            auto signal = message.getSignal(name).lock();
+            if (!signal) {
+                report(std::string(what) + " lookup", message, name);
+                return;
+            }
+            uint64_t mask = rawMask(*signal);
+            if (signal->isActive() && (static_cast<uint64_t>(field) & mask) != (signal->getRawValue() & mask)) {
+                report(what, message, name);
+            }
+            });
+    }
+
+    bool samePhysical(double a, double b)
+    {
+        return a == b || (std::isnan(a) && std::isnan(b));
+    }
+
+    // Compares the generated physical values of the signals present with the runtime message
+    template <typename Struct>
+    void comparePhysical(const char* what, Struct& decoded, CANMessage& message)
+    {
+        Struct::visitPhysical([&](const char* name, auto getPhysical, auto) {
+            auto signal = message.getSignal(name).lock();
+            if (signal && signal->isActive() && !samePhysical((decoded.*getPhysical)(), signal->getPhysicalValue())) {
+                report(std::string(what) + " physical", message, name);
+            }
+            });
+    }
+
+    // Physical values around the limits, rounding ties and special values of a signal, and random ones
+    std::vector<double> physicalInputs(const CANSignal& signal)
+    {
+        double factor = signal.getFactor();
+        double offset = signal.getOffset();
+        auto physical = [&](double scaled) { return scaled * factor + offset; };
+
+        double low = 0.0;
+        double high = static_cast<double>(rawMask(signal));
+        if (signal.getValueType() == Signed) {
+            high = std::ldexp(1.0, signal.getLength() - 1) - 1.0;
+            low = -high - 1.0;
+        }
+
+        std::vector<double> inputs = { 0.0, -0.0, -1.0, -123.25, 1e30, -1e30, std::numeric_limits<double>::infinity(),
+            -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN(), offset, physical(0.49999999999999994),
+            physical(-0.49999999999999994), physical(0.5), physical(-0.5), physical(1.5), physical(-2.5) };
+        for (double limit : { low, high }) {
+            for (double delta : { -1.0, -0.5, -0.49, 0.0, 0.49, 0.5, 1.0 }) {
+                inputs.push_back(physical(limit + delta));
+            }
+        }
+        for (int i = 0; i < 20; ++i) {
+            double scaled = low + (high - low) * static_cast<double>(engine() % 1000001) / 1000000.0;
+            inputs.push_back(physical(std::floor(scaled)));
+            inputs.push_back(physical(std::floor(scaled) + 0.5));
+        }
+        return inputs;
+    }
+
+    // Compares the raw values set by the generated physical setters with CANSignal::physicalToRaw
+    template <typename Struct>
+    void checkPhysicalSetters(CANMessage& message)
+    {
+        Struct::visitPhysical([&](const char* name, auto, auto setPhysical) {
+            auto signal = message.getSignal(name).lock();
+            if (!signal) {
+                return;
+            }
+            uint64_t mask = rawMask(*signal);
+            for (double value : physicalInputs(*signal)) {
+                Struct values{};
+                (values.*setPhysical)(value);
+                uint64_t raw = 0;
+                values.visit([&](const char* fieldName, auto& field) {
+                    if (std::strcmp(fieldName, name) == 0) {
+                        raw = static_cast<uint64_t>(field) & mask;
+                    }
+                    });
+                if (raw != (signal->physicalToRaw(value) & mask)) {
+                    report("setPhysical(" + std::to_string(value) + ")", message, name);
+                    break;
+                }
+            }
+            });
+    }
+
+    template <typename Struct>
+    void checkMessage(CANMessage& message)
+    {
+        if (static_cast<uint32_t>(Struct::MESSAGE_ID) != message.getId() || Struct::MESSAGE_LENGTH != message.getLength()) {
+            report("layout", message);
+            return;
+        }
+
+        auto branches = branchValues(message);
+        std::vector<uint8_t> frame(static_cast<size_t>(Struct::MESSAGE_LENGTH));
+        std::vector<uint8_t> encoded(static_cast<size_t>(Struct::MESSAGE_LENGTH));
+
+        for (int iteration = 0; iteration < Iterations; ++iteration) {
+            // Decoding of a random frame
+            for (uint8_t& byte : frame) {
+                byte = static_cast<uint8_t>(engine());
+            }
+            Struct decoded{};
+            decoded.decode(frame.data());
+            message.setData(frame.data(), Struct::MESSAGE_LENGTH);
+            compareSignals("decode", decoded, message);
+            comparePhysical("decode", decoded, message);
+
+            // Encoding of random raw values
+            Struct values{};
+            values.visit([&](const char* name, auto& field) {
+                auto signal = message.getSignal(name).lock();
+                if (!signal) {
+                    return;
+                }
+                uint64_t value = randomRaw(*signal, branches, engine);
+                field = static_cast<std::remove_reference_t<decltype(field)>>(value);
+                signal->setRawValue(value);
+                });
+            message.pack();
+
+            values.encode(encoded.data());
+            auto data = message.getData();
+            for (int i = 0; i < Struct::MESSAGE_LENGTH; ++i) {
+                if (encoded[i] != data[i]) {
+                    report("encode", message);
+                    break;
+                }
+            }
+
+            // Decoding of the encoded frame, through the multiplexer branches selected above
+            Struct roundTrip{};
+            roundTrip.decode(encoded.data());
+            message.setData(encoded.data(), Struct::MESSAGE_LENGTH);
+            compareSignals("round trip", roundTrip, message);
+            comparePhysical("round trip", roundTrip, message);
+        }
+
+        checkPhysicalSetters<Struct>(message);
+    }
+
+    template <typename ForEachMessage>
+    void checkBus(const std::string& path, ForEachMessage forEachMessage)
+    {
+        auto busManager = std::make_shared<CANBusManager>();
+        Parser parser(busManager);
+        if (!parser.loadDBC(path)) {
+            std::cerr << "Could not load " << path << std::endl;
+            ++failures;
+            return;
+        }
+
+        // The structs are generated in the order of the messages of the bus
+        auto bus = busManager->getBuses().begin()->second;
+        const auto& messages = bus->getAllMessages();
+        size_t index = 0;
+        forEachMessage([&](auto prototype) {
+            if (index < messages.size()) {
+                checkMessage<decltype(prototype)>(*messages[index]);
+            }
+            ++index;
+            });
+
+        if (index != messages.size()) {
+            std::cerr << path << ": " << index << " generated structs for " << messages.size() << " messages" << std::endl;
+            ++failures;
+        }
+    }
+}
+
+int main()
+{
+#define CHECK_BUS(busNamespace, path) checkBus(path, [](auto&& visitor) { busNamespace::forEachMessage(visitor); });
+    CODEGEN_BUSES(CHECK_BUS)
+#undef CHECK_BUS
+
+    if (failures > 0) {
+        std::cerr << failures << " mismatches" << std::endl;
+        return 1;
+    }
+    std::cout << "Generated headers match the runtime model" << std::endl;
+    return 0;
+}
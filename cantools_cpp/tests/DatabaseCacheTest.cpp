@@ -0,0 +1,175 @@
+/**
+ * @file DatabaseCacheTest.cpp
+ * @brief Checks that the database cache loads the same bus as the DBC and that invalid caches fall back to parsing.
+ *
+ * Each DBC file given on the command line is copied to a temporary directory and loaded through
+ * Parser::loadCachedDBC, which writes its cache. The bus loaded back from the cache must dump as the
+ * parsed one: messages, signals, multiplexing, signal table rows and decoded frames. Caches with a
+ * flipped byte, cut short or written for another content of the DBC must be rejected without creating
+ * anything, and loadCachedDBC must then parse the DBC again.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "DatabaseCache.hpp"
+#include "Parser.hpp"
+#include "TestSupport.hpp"
+
+using namespace cantools_cpp;
+using namespace cantools_cpp::test;
+
+namespace
+{
+    int failures = 0;
+
+    void report(const std::string& what)
+    {
+        ++failures;
+        std::cerr << what << std::endl;
+    }
+
+    std::vector<uint8_t> readFile(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    void writeFile(const std::filesystem::path& path, const std::vector<uint8_t>& content)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(content.data()), static_cast<std::streamsize>(content.size()));
+    }
+
+    std::string busName(const std::filesystem::path& dbc)
+    {
+        return dbc.stem().string();
+    }
+
+    // Dump of the bus parsed from the DBC, without any cache
+    std::string parse(const std::filesystem::path& dbc)
+    {
+        auto busManager = std::make_shared<CANBusManager>();
+        Parser parser(busManager);
+        return parser.loadDBC(dbc.string()) ? dumpBus(*busManager->getBus(busName(dbc))) : std::string();
+    }
+
+    // Dump of the bus loaded from the cache alone, empty if the cache is rejected
+    std::string loadCache(const std::filesystem::path& dbc, const std::filesystem::path& cache, const std::string& what)
+    {
+        std::vector<uint8_t> source = readFile(dbc);
+        auto busManager = std::make_shared<CANBusManager>();
+        if (!DatabaseCache::load(cache.string(), DatabaseCache::hash(source.data(), source.size()), source.size(), busManager, busName(dbc))) {
+            if (!busManager->getBuses().empty()) {
+                report(what + ": a rejected cache created a bus");
+            }
+            return std::string();
+        }
+        return dumpBus(*busManager->getBus(busName(dbc)));
+    }
+
+    // Dump of the bus loaded by loadCachedDBC, which either uses or rewrites the cache
+    std::string loadCached(const std::filesystem::path& dbc, const std::filesystem::path& cache)
+    {
+        auto busManager = std::make_shared<CANBusManager>();
+        Parser parser(busManager);
+        return parser.loadCachedDBC(dbc.string(), cache.string()) ? dumpBus(*busManager->getBus(busName(dbc))) : std::string();
+    }
+
+    void checkSame(const std::string& what, const std::string& expected, const std::string& actual)
+    {
+        if (actual.empty()) {
+            report(what + ": nothing loaded");
+        }
+        else if (actual != expected) {
+            report(what + ": the bus differs from the parsed one:" + firstDifference(expected, actual));
+        }
+    }
+
+    // A damaged cache is rejected, then replaced by loadCachedDBC with a valid one
+    void checkRejected(const std::string& what, const std::filesystem::path& dbc, const std::filesystem::path& cache, const std::string& parsed)
+    {
+        if (!loadCache(dbc, cache, what).empty()) {
+            report(what + ": the cache was accepted");
+        }
+        checkSame(what + " fallback", parsed, loadCached(dbc, cache));
+        checkSame(what + " rewritten cache", parsed, loadCache(dbc, cache, what));
+    }
+
+    void checkFile(const std::filesystem::path& original, const std::filesystem::path& directory)
+    {
+        std::filesystem::path dbc = directory / original.filename();
+        std::filesystem::path cache = directory / (original.filename().string() + ".cache");
+        std::filesystem::copy_file(original, dbc, std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::remove(cache);
+        std::string name = original.filename().string();
+
+        std::string parsed = parse(dbc);
+        if (parsed.empty()) {
+            report("Could not load " + original.string());
+            return;
+        }
+
+        // The first load parses and writes the cache, the next ones load it
+        checkSame(name + " first load", parsed, loadCached(dbc, cache));
+        if (!std::filesystem::exists(cache)) {
+            report(name + ": no cache written");
+            return;
+        }
+        checkSame(name + " cache", parsed, loadCache(dbc, cache, name));
+        checkSame(name + " cached load", parsed, loadCached(dbc, cache));
+
+        std::vector<uint8_t> valid = readFile(cache);
+        for (size_t position : { size_t(0), size_t(8), valid.size() / 2, valid.size() - 1 }) {
+            std::vector<uint8_t> flipped = valid;
+            flipped[position] ^= 0x10;
+            writeFile(cache, flipped);
+            checkRejected(name + " flipped byte " + std::to_string(position), dbc, cache, parsed);
+        }
+        for (size_t size : { size_t(0), size_t(16), valid.size() / 2, valid.size() - 1 }) {
+            writeFile(cache, std::vector<uint8_t>(valid.begin(), valid.begin() + static_cast<std::ptrdiff_t>(size)));
+            checkRejected(name + " cut to " + std::to_string(size) + " bytes", dbc, cache, parsed);
+        }
+
+        // A cache of the previous content of a changed DBC is not used for the new content
+        writeFile(cache, valid);
+        {
+            std::ofstream file(dbc, std::ios::app);
+            file << "\nBO_ 2147483903 CacheTestAdded: 8 Vector__XXX\n SG_ Added : 0|8@1+ (1,0) [0|255] \"\" Vector__XXX\n";
+        }
+        std::string changed = parse(dbc);
+        if (changed.find("CacheTestAdded") == std::string::npos) {
+            report(name + ": the changed DBC does not load the added message");
+        }
+        checkRejected(name + " changed source", dbc, cache, changed);
+
+        std::filesystem::remove(dbc);
+        std::filesystem::remove(cache);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "cantools_database_cache_test";
+    std::filesystem::create_directories(directory);
+    for (int i = 1; i < argc; ++i) {
+        checkFile(argv[i], directory);
+    }
+    std::filesystem::remove_all(directory);
+
+    if (failures > 0) {
+        std::cerr << failures << " failures" << std::endl;
+        return 1;
+    }
+    std::cout << "Database caches match the parsed buses and invalid ones fall back to parsing" << std::endl;
+    return 0;
+}
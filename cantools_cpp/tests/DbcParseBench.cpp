@@ -0,0 +1,267 @@
+/**
+ * @file DbcParseBench.cpp
+ * @brief Measures the DBC loading throughput of the tokenizer based line parsers against std::regex.
+ *
+ * The regular expressions and field conversions of the line parsers before DbcTokenizer are kept here as
+ * reference parsers, building the same models. Each DBC file given on the command line, and a generated
+ * file, is loaded on one thread with both sets of parsers; the best of a few loads is reported in lines
+ * per second. The generated file has 5000 messages (about 2 MB) unless "--messages <count>" asks for
+ * another size; the bench target generates 250000 messages, about 100 MB.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+#include "CANNode.hpp"
+#include "CANSignal.hpp"
+#include "DbcReader.hpp"
+#include "ILineParser.hpp"
+#include "Parser.hpp"
+#include "TestSupport.hpp"
+
+using namespace cantools_cpp;
+using namespace cantools_cpp::test;
+
+namespace
+{
+    constexpr int Repetitions = 5;
+    constexpr size_t DefaultGeneratedMessages = 5000;
+
+    // The reference parsers convert with std::stoul and std::stof, which throw on malformed fields where the
+    // tokenizer rejects the line; the line is rejected here as well so that every file can be loaded
+    class RegexLineParser : public ILineParser {
+    public:
+        bool tryParse(std::string_view line, std::shared_ptr<CANBusManager> busMan, const std::string& busName) override {
+            try {
+                return parse(std::string(line), busMan, busName);
+            }
+            catch (const std::exception&) {
+                return false;
+            }
+        }
+
+    protected:
+        virtual bool parse(const std::string& line, const std::shared_ptr<CANBusManager>& busMan, const std::string& busName) = 0;
+    };
+
+    class RegexMessageLineParser : public RegexLineParser {
+        bool parse(const std::string& line, const std::shared_ptr<CANBusManager>& busMan, const std::string& busName) override {
+            static const std::regex messageRegex(R"(BO_ (\d+)\s+([a-zA-Z_]\w*)\s*:\s*(\d+)\s+([a-zA-Z_]\w*))");
+            std::string trimmed = line;
+            trimmed.erase(0, trimmed.find_first_not_of(" \t\n\r\f\v"));
+            if (trimmed.substr(0, 4) != "BO_ ")
+                return false;
+
+            std::smatch match;
+            if (!std::regex_search(trimmed, match, messageRegex))
+                return false;
+            auto bus = busMan->getBus(busName);
+            auto message = bus->create<CANMessage>(static_cast<uint32_t>(std::stoul(match.str(1))), busMan->getStringPool(), bus->getArena().get());
+            message->setName(match.str(2));
+            message->setLength(static_cast<unsigned short>(std::stoi(match.str(3))));
+            message->setTransmitter(match.str(4));
+            bus->addTransmittedMessage(message);
+            return true;
+        }
+    };
+
+    class RegexExtraMessageLineParser : public RegexLineParser {
+        bool parse(const std::string& line, const std::shared_ptr<CANBusManager>& busMan, const std::string& busName) override {
+            static const std::regex extraTransmitterRegex(R"(BO_TX_BU_ (\d+)\s*:\s*((\s*(?:[a-zA-Z_][\w]*)\s*(?:,)?)+);)");
+            std::string trimmed = line;
+            trimmed.erase(0, trimmed.find_first_not_of(" \t\n\r\f\v"));
+            if (trimmed.substr(0, 10) != "BO_TX_BU_ ")
+                return false;
+
+            std::smatch match;
+            if (!std::regex_search(trimmed, match, extraTransmitterRegex))
+                return false;
+            std::vector<std::string> transmitters;
+            std::stringstream stream(match.str(2));
+            std::string item;
+            while (std::getline(stream, item, ',')) {
+                auto start = item.find_first_not_of(" \t\n\r\f\v");
+                auto end = item.find_last_not_of(" \t\n\r\f\v");
+                if (start != std::string::npos) {
+                    item = item.substr(start, end - start + 1);
+                }
+                transmitters.push_back(item);
+            }
+            auto message = busMan->getBus(busName)->getMessageById(static_cast<uint32_t>(std::stoul(match.str(1))));
+            if (message) {
+                message->setAdditionalTransmitters(transmitters);
+            }
+            return true;
+        }
+    };
+
+    class RegexNodeLineParser : public RegexLineParser {
+        bool parse(const std::string& line, const std::shared_ptr<CANBusManager>& busMan, const std::string& busName) override {
+            static const std::regex nodeRegex(R"(BU_:\s*((?:\s+[a-zA-Z_][\w]*\s*)+))");
+            if (line.find("BU_:") != 0)
+                return false;
+            if (line == "BU_:")
+                return true;
+
+            std::smatch match;
+            if (std::regex_match(line, match, nodeRegex)) {
+                std::istringstream nodeStream(match.str(1));
+                std::string nodeName;
+                auto bus = busMan->getBus(busName);
+                while (nodeStream >> nodeName) {
+                    bus->create<CANNode>(nodeName, busName, *busMan)->attachToBus();
+                }
+            }
+            return true;
+        }
+    };
+
+    class RegexSignalLineParser : public RegexLineParser {
+        bool parse(const std::string& line, const std::shared_ptr<CANBusManager>& busMan, const std::string& busName) override {
+            static const std::regex signalRegex(
+                R"regex(\s*SG_\s+([\w]+)\s*([Mm\d]*)\s*:\s*(\d+)\|(\d+)@([01])([+-])\s+\(([\d\+\-eE.]+),([\d\+\-eE.]+)\)\s+\[([\d\+\-eE.]+)\|([\d\+\-eE.]+)\]\s+"([^"]*)"\s+([\w\s,]+))regex");
+            std::smatch match;
+            if (!std::regex_match(line, match, signalRegex))
+                return false;
+
+            auto bus = busMan->getBus(busName);
+            auto signal = bus->create<CANSignal>(match[1].str(), static_cast<uint8_t>(std::stoi(match[3].str())), static_cast<uint8_t>(std::stoi(match[4].str())),
+                std::stof(match[7].str()), std::stof(match[8].str()), std::stof(match[9].str()), std::stof(match[10].str()), match[11].str(),
+                static_cast<uint8_t>(std::stoi(match[5].str())), match[6].str() == "-" ? DbcValueType::Signed : DbcValueType::Unsigned, match[12].str(),
+                match[2].str(), busMan->getStringPool(), bus->getSignalTable(), bus->getArena().get());
+            bus->addSignal(signal);
+            return true;
+        }
+    };
+
+    class RegexSignalValueTypeLineParser : public RegexLineParser {
+        bool parse(const std::string& line, const std::shared_ptr<CANBusManager>& busMan, const std::string& busName) override {
+            static const std::regex signalValueTypeRegex(R"(SIG_VALTYPE_\s+(\d+)\s+([a-zA-Z_]\w*)\s*:\s*([0123])\s*;)");
+            if (line.find("SIG_VALTYPE_ ") != 0)
+                return false;
+
+            std::smatch match;
+            if (!std::regex_match(line, match, signalValueTypeRegex))
+                return false;
+            uint32_t signalType = static_cast<uint32_t>(std::stoul(match[3].str()));
+            if (signalType == 1 || signalType == 2) {
+                busMan->getBus(busName)->addSignalValueType(static_cast<uint32_t>(std::stoul(match[1].str())), match[2].str(),
+                    signalType == 1 ? IEEEFloat : IEEEDouble);
+            }
+            return true;
+        }
+    };
+
+    class RegexSignalMultiplexerValueLineParser : public RegexLineParser {
+        bool parse(const std::string& line, const std::shared_ptr<CANBusManager>& busMan, const std::string& busName) override {
+            static const std::regex signalMultiplexerValueRegex(R"(\s*SG_MUL_VAL_\s+(\d+)\s+([a-zA-Z_]\w*)\s+([a-zA-Z_]\w*)\s+([\d\s,\-]+);\s*)");
+            static const std::regex rangeRegex(R"((\d+)\s*-\s*(\d+))");
+            if (line.find("SG_MUL_VAL_ ") == std::string::npos)
+                return false;
+
+            std::smatch match;
+            if (!std::regex_match(line, match, signalMultiplexerValueRegex))
+                return false;
+            std::string rangeList = match[4].str();
+            std::vector<MultiplexerRange> values;
+            for (std::sregex_iterator it(rangeList.begin(), rangeList.end(), rangeRegex), end; it != end; ++it) {
+                values.push_back({ std::stoull((*it)[1].str()), std::stoull((*it)[2].str()) });
+            }
+            busMan->getBus(busName)->addSignalMultiplexerValues(static_cast<uint32_t>(std::stoul(match[1].str())), match[2].str(), match[3].str(), values);
+            return true;
+        }
+    };
+
+    size_t countStatements(const std::string& path)
+    {
+        DbcReader reader(path);
+        size_t count = 0;
+        std::string_view statement;
+        while (reader.next(statement)) {
+            ++count;
+        }
+        return count;
+    }
+
+    // Best loading time of the file over the repetitions, in seconds
+    double bestLoad(const std::string& path, bool regex)
+    {
+        double best = 0.0;
+        for (int repetition = 0; repetition < Repetitions; ++repetition) {
+            auto busManager = std::make_shared<CANBusManager>();
+            Parser parser(busManager);
+            parser.setThreadCount(1);
+            if (regex) {
+                parser.addLineParser("BU_", std::make_shared<RegexNodeLineParser>());
+                parser.addLineParser("BO_", std::make_shared<RegexMessageLineParser>());
+                parser.addLineParser("BO_TX_BU_", std::make_shared<RegexExtraMessageLineParser>());
+                parser.addLineParser("SG_", std::make_shared<RegexSignalLineParser>());
+                parser.addLineParser("SIG_VALTYPE_", std::make_shared<RegexSignalValueTypeLineParser>());
+                parser.addLineParser("SG_MUL_VAL_", std::make_shared<RegexSignalMultiplexerValueLineParser>());
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            parser.loadDBC(path);
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            best = repetition == 0 ? seconds : std::min(best, seconds);
+        }
+        return best;
+    }
+
+    void run(const std::string& path)
+    {
+        size_t statements = countStatements(path);
+        double regexLinesPerSecond = statements / bestLoad(path, true);
+        double tokenizerLinesPerSecond = statements / bestLoad(path, false);
+
+        std::cout << std::setw(28) << std::filesystem::path(path).stem().string() << std::setw(10) << statements
+            << std::setw(14) << regexLinesPerSecond / 1000.0 << std::setw(14) << tokenizerLinesPerSecond / 1000.0
+            << std::setw(10) << tokenizerLinesPerSecond / regexLinesPerSecond << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t generatedMessages = DefaultGeneratedMessages;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--messages" && i + 1 < argc) {
+            generatedMessages = std::stoul(argv[++i]);
+        }
+        else {
+            files.push_back(argv[i]);
+        }
+    }
+
+    std::string generated = (std::filesystem::temp_directory_path() / "cantools_parse_bench.dbc").string();
+    if (!writeGeneratedDbc(generated, generatedMessages)) {
+        std::cerr << "Could not write " << generated << std::endl;
+        return 1;
+    }
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "k lines/s loading on one thread, best of " << Repetitions << "; generated file of " << generatedMessages << " messages, "
+        << std::filesystem::file_size(generated) / (1024 * 1024) << " MB" << std::endl;
+    std::cout << std::setw(28) << "file" << std::setw(10) << "lines" << std::setw(14) << "std::regex" << std::setw(14) << "tokenizer"
+        << std::setw(10) << "speedup" << std::endl;
+    for (const std::string& file : files) {
+        run(file);
+    }
+    run(generated);
+
+    std::filesystem::remove(generated);
+    return 0;
+}
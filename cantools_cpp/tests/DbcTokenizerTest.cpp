@@ -0,0 +1,104 @@
+/**
+ * @file DbcTokenizerTest.cpp
+ * @brief Checks the number conversion of DbcTokenizer and the loading of signals with limits out of float range.
+ *
+ * The DBC file given on the command line holds signals whose limits were written for doubles; they must
+ * be loaded with their limits saturated instead of being dropped.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <cfloat>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+#include "CANSignal.hpp"
+#include "DbcTokenizer.hpp"
+#include "Parser.hpp"
+
+using namespace cantools_cpp;
+
+namespace
+{
+    int failures = 0;
+
+    void report(const std::string& what)
+    {
+        ++failures;
+        std::cerr << what << std::endl;
+    }
+
+    // Reads a number followed by the rest of a field, e.g. "1.5|", and checks the value and the next character
+    void checkNumber(std::string_view text, bool accepted, float expected = 0.0f, char next = '\0')
+    {
+        DbcTokenizer tokens(text);
+        float value = 0.0f;
+        bool read = tokens.readNumber(value);
+        if (read != accepted) {
+            report("readNumber(\"" + std::string(text) + "\") " + (accepted ? "rejected" : "accepted"));
+        }
+        else if (read && (value != expected || std::signbit(value) != std::signbit(expected) || tokens.peek() != next)) {
+            report("readNumber(\"" + std::string(text) + "\") read " + std::to_string(value) + " followed by '" + tokens.peek() + "'");
+        }
+        else if (!read && tokens.position() != 0) {
+            report("readNumber(\"" + std::string(text) + "\") consumed a rejected number");
+        }
+    }
+
+    void checkSignal(CANMessage& message, const std::string& name, float minVal, float maxVal)
+    {
+        auto signal = message.getSignal(name).lock();
+        if (!signal) {
+            report("signal " + name + " not loaded");
+        }
+        else if (signal->getMinVal() != minVal || signal->getMaxVal() != maxVal) {
+            report("signal " + name + " limits [" + std::to_string(signal->getMinVal()) + "|" + std::to_string(signal->getMaxVal()) + "]");
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    checkNumber("1.5|", true, 1.5f, '|');
+    checkNumber("+2e3,", true, 2000.0f, ',');
+    checkNumber("-0.25)", true, -0.25f, ')');
+    checkNumber("1.79769313486232E+308|", true, FLT_MAX, '|');
+    checkNumber("-1.79769313486232E+308]", true, -FLT_MAX, ']');
+    checkNumber("123456789012345678901234567890123456789012345", true, FLT_MAX);
+    checkNumber("1e99999999999999999999", true, FLT_MAX);
+    checkNumber("1E-60", true, 0.0f);
+    checkNumber("-0.00000000000000000000000000000000000000000000001", true, -0.0f);
+    checkNumber("1e-99999999999999999999", true, 0.0f);
+    checkNumber("e5", false);
+    checkNumber("", false);
+    checkNumber("|", false);
+
+    if (argc < 2) {
+        report("usage: DbcTokenizerTest <float_limits.dbc>");
+    }
+    else {
+        auto busManager = std::make_shared<CANBusManager>();
+        Parser parser(busManager);
+        auto message = parser.loadDBC(argv[1]) ? busManager->getBuses().begin()->second->getMessageById(600) : nullptr;
+        if (!message) {
+            report(std::string("Could not load ") + argv[1]);
+        }
+        else {
+            checkSignal(*message, "Unbounded", -FLT_MAX, FLT_MAX);
+            checkSignal(*message, "Tiny", 0.0f, 65535.0f);
+            checkSignal(*message, "Plain", -8.0f, 16375.75f);
+        }
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " failures" << std::endl;
+        return 1;
+    }
+    std::cout << "Numbers out of float range saturate" << std::endl;
+    return 0;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file MessageIndexTest.cpp
+ * @brief Checks that CANBus::getMessageById stays consistent with the message IDs when setId is called.
+ *
+ * The DBC file given on the command line is loaded, then messages take the ID of another message, fresh
+ * IDs and their former IDs back, first in the sequence of the clash reported on tesla_can, then at
+ * random. After each change every ID of the bus must still be found, on a message holding that ID,
+ * as the linear scan of the messages used to find it.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+#include "Parser.hpp"
+
+using namespace cantools_cpp;
+
+namespace
+{
+    constexpr int RandomChanges = 2000;
+    constexpr int MaxReported = 20;
+
+    int failures = 0;
+
+    void report(const std::string& what)
+    {
+        if (++failures <= MaxReported) {
+            std::cerr << what << std::endl;
+        }
+    }
+
+    void checkIndex(const CANBus& bus, const std::string& step)
+    {
+        std::set<uint32_t> ids;
+        for (const auto& message : bus.getAllMessages()) {
+            ids.insert(message->getId());
+        }
+        for (uint32_t id : ids) {
+            auto found = bus.getMessageById(id);
+            if (!found || found->getId() != id) {
+                report(step + ": message ID " + std::to_string(id) + " not found");
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "usage: MessageIndexTest <dbc file>" << std::endl;
+        return 1;
+    }
+
+    auto busManager = std::make_shared<CANBusManager>();
+    Parser parser(busManager);
+    if (!parser.loadDBC(argv[1])) {
+        std::cerr << "Could not load " << argv[1] << std::endl;
+        return 1;
+    }
+    CANBus& bus = *busManager->getBuses().begin()->second;
+    std::vector<std::shared_ptr<CANMessage>> messages = bus.getAllMessages();
+    if (messages.size() < 2) {
+        std::cerr << "The test needs two messages" << std::endl;
+        return 1;
+    }
+    checkIndex(bus, "load");
+
+    // A message takes the ID of another one and gets its own back
+    auto a = messages[0];
+    auto b = messages[1];
+    uint32_t oldA = a->getId();
+    a->setId(b->getId());
+    checkIndex(bus, "clash");
+    if (bus.getMessageById(b->getId()) != b) {
+        report("clash: the first message holding the ID lost it");
+    }
+    a->setId(oldA);
+    checkIndex(bus, "restore");
+    if (bus.getMessageById(b->getId()) != b || bus.getMessageById(oldA) != a) {
+        report("restore: the messages are not found by their IDs");
+    }
+
+    // The first holder leaves the ID, the other one takes it over
+    a->setId(b->getId());
+    uint32_t oldB = b->getId();
+    b->setId(0x1FFFFFF0u);
+    checkIndex(bus, "hand over");
+    if (bus.getMessageById(oldB) != a || bus.getMessageById(0x1FFFFFF0u) != b) {
+        report("hand over: the remaining holder of the ID is not found");
+    }
+
+    // Random changes between the IDs of the bus and fresh ones
+    std::mt19937_64 engine(0x1d5);
+    for (int change = 0; change < RandomChanges; ++change) {
+        auto& message = messages[engine() % messages.size()];
+        uint32_t id = engine() % 2 ? messages[engine() % messages.size()]->getId() : static_cast<uint32_t>(engine() % 0x900);
+        message->setId(id);
+        checkIndex(bus, "change " + std::to_string(change));
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " failures" << std::endl;
+        return 1;
+    }
+    std::cout << "Message lookups follow setId" << std::endl;
+    return 0;
+}
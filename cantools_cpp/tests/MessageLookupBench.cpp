@@ -0,0 +1,135 @@
+/**
+ * @file MessageLookupBench.cpp
+ * @brief Measures the latency of CANBus::getMessageById through the message index.
+ *
+ * The real IDs of the DBC files given on the command line are looked up, then buses of increasing size
+ * filled with 30% standard and 70% extended IDs, up to 5000 messages. Random known and unknown IDs are
+ * looked up in each. The linear scan of the message list, which getMessageById did before MessageIndex,
+ * is measured on the same IDs as a reference.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include <filesystem>
+#include <string>
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+#include "Parser.hpp"
+
+using namespace cantools_cpp;
+
+namespace
+{
+    constexpr size_t LookupCount = 1 << 20;
+    constexpr uint32_t ExtendedFlag = 0x80000000u;
+
+    // Consumes the lookup results so that the loops are not optimized away
+    volatile uintptr_t sink = 0;
+
+    template <typename Lookup>
+    double nanosecondsPerLookup(const std::vector<uint32_t>& ids, size_t count, Lookup lookup)
+    {
+        uintptr_t checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            checksum += reinterpret_cast<uintptr_t>(lookup(ids[i % ids.size()]));
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        sink = sink + checksum;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(count);
+    }
+
+    // Looks up random known IDs of the bus and unknown ones
+    void measure(const std::string& label, const CANBus& bus, const std::vector<uint32_t>& known, std::mt19937& engine)
+    {
+        size_t messageCount = bus.getAllMessages().size();
+        std::vector<uint32_t> hits(4096);
+        std::vector<uint32_t> misses(4096);
+        for (size_t i = 0; i < hits.size(); ++i) {
+            hits[i] = known[engine() % known.size()];
+            do {
+                misses[i] = (engine() & 0x1FFFFFFFu) | ExtendedFlag;
+            } while (bus.getMessageById(misses[i]));
+        }
+
+        auto indexed = [&bus](uint32_t id) { return bus.getMessageById(id).get(); };
+        const auto& messages = bus.getAllMessages();
+        auto linear = [&messages](uint32_t id) -> CANMessage* {
+            for (const auto& message : messages) {
+                if (message->getId() == id) {
+                    return message.get();
+                }
+            }
+            return nullptr;
+        };
+
+        // The linear scan gets fewer lookups on large buses to keep the run short
+        size_t linearCount = std::max<size_t>(4096, LookupCount / messageCount);
+
+        std::cout << std::setw(16) << label
+            << std::setw(14) << nanosecondsPerLookup(hits, LookupCount, indexed)
+            << std::setw(14) << nanosecondsPerLookup(misses, LookupCount, indexed)
+            << std::setw(14) << nanosecondsPerLookup(hits, linearCount, linear)
+            << std::setw(14) << nanosecondsPerLookup(misses, linearCount, linear) << std::endl;
+    }
+
+    void run(size_t messageCount, std::mt19937& engine)
+    {
+        CANBus bus("Bench");
+        std::vector<uint32_t> known;
+        while (bus.getAllMessages().size() < messageCount) {
+            uint32_t id = engine() % 10 < 3 ? engine() % 0x800 : (engine() & 0x1FFFFFFFu) | ExtendedFlag;
+            if (bus.getMessageById(id)) {
+                continue;
+            }
+            auto message = std::make_shared<CANMessage>(id);
+            message->setName("M" + std::to_string(id));
+            message->setLength(8);
+            bus.addMessage(message);
+            known.push_back(id);
+        }
+        measure(std::to_string(messageCount), bus, known, engine);
+    }
+
+    void runFile(const std::string& path, std::mt19937& engine)
+    {
+        auto busManager = std::make_shared<CANBusManager>();
+        Parser parser(busManager);
+        if (!parser.loadDBC(path)) {
+            std::cerr << "Could not load " << path << std::endl;
+            return;
+        }
+        const CANBus& bus = *busManager->getBuses().begin()->second;
+        std::vector<uint32_t> known;
+        for (const auto& message : bus.getAllMessages()) {
+            known.push_back(message->getId());
+        }
+        measure(std::filesystem::path(path).stem().string() + " (" + std::to_string(known.size()) + ")", bus, known, engine);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::mt19937 engine(0x1d);
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "ns per getMessageById (index) and per linear scan of the messages" << std::endl;
+    std::cout << std::setw(16) << "messages" << std::setw(14) << "index hit" << std::setw(14) << "index miss"
+        << std::setw(14) << "linear hit" << std::setw(14) << "linear miss" << std::endl;
+    for (int i = 1; i < argc; ++i) {
+        runFile(argv[i], engine);
+    }
+    for (size_t messageCount : { 16, 64, 256, 1024, 5000 }) {
+        run(messageCount, engine);
+    }
+    return 0;
+}
@@ -0,0 +1,171 @@
+/**
+ * @file MultiplexBench.cpp
+ * @brief Measures the multiplexing checks of the pack paths on several cores.
+ *
+ * Several threads evaluate CANSignal::isActive() on the multiplexed signals of a shared, decoded
+ * database, which walks the multiplexors through plain pointers. The previous implementation, locking
+ * the weak pointer of each multiplexor, is reproduced on the same signals as a reference: its atomic
+ * reference counting makes the threads contend on the control blocks of the multiplexors. Each thread
+ * then packs the multiplexed messages of its own copy of the database.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+#include "CANSignal.hpp"
+#include "Parser.hpp"
+
+using namespace cantools_cpp;
+
+namespace
+{
+    constexpr size_t CheckCount = 1 << 22;  ///< isActive() calls per thread
+    constexpr size_t PackCount = 1 << 17;   ///< pack() calls per thread
+
+    std::atomic<size_t> sink{ 0 };
+
+    // CANSignal::isActive() as it was, through the reference counted multiplexor
+    bool lockingIsActive(const CANSignal& signal)
+    {
+        if (signal.getMultiplexerValues().empty()) {
+            return true;
+        }
+        auto multiplexor = signal.getMultiplexorSignal();
+        if (!multiplexor) {
+            return true;
+        }
+        return signal.isMultiplexerValue(multiplexor->getRawValue()) && lockingIsActive(*multiplexor);
+    }
+
+    std::shared_ptr<CANBusManager> load(const std::vector<std::string>& paths)
+    {
+        auto busManager = std::make_shared<CANBusManager>();
+        Parser parser(busManager);
+        for (const std::string& path : paths) {
+            parser.loadDBC(path);
+        }
+
+        // Decoded data, so that some branches are active
+        for (CANBus& bus : busManager->getBusView()) {
+            for (CANMessage& message : bus.getMessageView()) {
+                std::vector<uint8_t> frame(static_cast<size_t>(message.getLength()), 0x01);
+                message.setData(frame.data(), message.getLength());
+            }
+        }
+        return busManager;
+    }
+
+    std::vector<CANMessage*> multiplexedMessages(CANBusManager& busManager)
+    {
+        std::vector<CANMessage*> messages;
+        for (CANBus& bus : busManager.getBusView()) {
+            for (CANMessage& message : bus.getMessageView()) {
+                const auto& signals = message.getSignals();
+                if (std::any_of(signals.begin(), signals.end(), [](const auto& signal) { return signal->isMultiplexed(); })) {
+                    messages.push_back(&message);
+                }
+            }
+        }
+        return messages;
+    }
+
+    // Runs work(thread) on threadCount threads started together, and returns the operations per second
+    template <typename Work>
+    double throughput(unsigned threadCount, size_t operationsPerThread, Work work)
+    {
+        std::atomic<unsigned> ready{ 0 };
+        std::atomic<bool> go{ false };
+        std::vector<std::thread> threads;
+        for (unsigned thread = 0; thread < threadCount; ++thread) {
+            threads.emplace_back([&, thread]() {
+                ++ready;
+                while (!go) {
+                    std::this_thread::yield();
+                }
+                work(thread);
+                });
+        }
+        while (ready < threadCount) {
+            std::this_thread::yield();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        go = true;
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<double>(operationsPerThread * threadCount) / elapsed.count();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> paths(argv + 1, argv + argc);
+    auto shared = load(paths);
+
+    std::vector<const CANSignal*> signals;
+    for (CANMessage* message : multiplexedMessages(*shared)) {
+        for (const auto& signal : message->getSignals()) {
+            if (signal->isMultiplexed()) {
+                signals.push_back(signal.get());
+            }
+        }
+    }
+    if (signals.empty()) {
+        std::cerr << "No multiplexed signal in the given DBC files" << std::endl;
+        return 1;
+    }
+
+    unsigned maxThreads = std::max(4u, std::thread::hardware_concurrency());
+    std::vector<std::shared_ptr<CANBusManager>> copies;
+    for (unsigned thread = 0; thread < maxThreads; ++thread) {
+        copies.push_back(load(paths));
+    }
+
+    std::cout << signals.size() << " multiplexed signals, " << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::setw(8) << "threads" << std::setw(20) << "isActive (M/s)" << std::setw(20) << "weak_ptr (M/s)"
+        << std::setw(20) << "pack (M/s)" << std::endl;
+
+    for (unsigned threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+        double active = throughput(threadCount, CheckCount, [&](unsigned) {
+            size_t count = 0;
+            for (size_t i = 0; i < CheckCount; ++i) {
+                count += signals[i % signals.size()]->isActive();
+            }
+            sink += count;
+            });
+
+        double locking = throughput(threadCount, CheckCount, [&](unsigned) {
+            size_t count = 0;
+            for (size_t i = 0; i < CheckCount; ++i) {
+                count += lockingIsActive(*signals[i % signals.size()]);
+            }
+            sink += count;
+            });
+
+        double pack = throughput(threadCount, PackCount, [&](unsigned thread) {
+            std::vector<CANMessage*> messages = multiplexedMessages(*copies[thread]);
+            for (size_t i = 0; i < PackCount; ++i) {
+                messages[i % messages.size()]->pack();
+            }
+            });
+
+        std::cout << std::setw(8) << threadCount << std::setw(20) << active / 1e6 << std::setw(20) << locking / 1e6
+            << std::setw(20) << pack / 1e6 << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file MultiplexerIndicatorTest.cpp
+ * @brief Checks that malformed multiplexer indicators are rejected instead of aborting the load.
+ *
+ * A DBC file mixing valid indicators (M, mN, mNM) with malformed ones (mM, mm1, m, a value beyond 64 bits)
+ * is loaded: the valid signals must be multiplexed as declared and the malformed ones skipped. Signals
+ * created directly with a malformed indicator must be plain signals.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+#include "CANSignal.hpp"
+#include "Parser.hpp"
+
+using namespace cantools_cpp;
+
+namespace
+{
+    int failures = 0;
+
+    void report(const std::string& what)
+    {
+        ++failures;
+        std::cerr << what << std::endl;
+    }
+
+    void checkSignal(CANMessage& message, const std::string& name, bool present, bool multiplexor = false, bool multiplexed = false, uint64_t value = 0)
+    {
+        auto signal = message.getSignal(name).lock();
+        if (!signal) {
+            if (present) {
+                report("signal " + name + " not loaded");
+            }
+            return;
+        }
+        if (!present) {
+            report("signal " + name + " loaded despite its malformed indicator");
+        }
+        else if (signal->isMultiplexor() != multiplexor || signal->isMultiplexed() != multiplexed ||
+            (multiplexed && signal->getMultiplexerValues().front().low != value)) {
+            report("signal " + name + " has the wrong multiplexing");
+        }
+    }
+}
+
+int main()
+{
+    std::string path = (std::filesystem::temp_directory_path() / "cantools_multiplexer_indicator_test.dbc").string();
+    {
+        std::ofstream file(path);
+        file << "BU_: ECU\n\n"
+            << "BO_ 100 Muxed: 8 ECU\n"
+            << " SG_ Sel M : 0|8@1+ (1,0) [0|255] \"\" ECU\n"
+            << " SG_ Inner m1M : 8|4@1+ (1,0) [0|15] \"\" ECU\n"
+            << " SG_ Leaf m2 : 12|4@1+ (1,0) [0|15] \"\" ECU\n"
+            << " SG_ Both mM : 16|8@1+ (1,0) [0|255] \"\" ECU\n"
+            << " SG_ Twice mm1 : 24|8@1+ (1,0) [0|255] \"\" ECU\n"
+            << " SG_ Bare m : 32|8@1+ (1,0) [0|255] \"\" ECU\n"
+            << " SG_ Huge m1234567890123456789012345 : 40|8@1+ (1,0) [0|255] \"\" ECU\n"
+            << " SG_ Reversed 1m : 48|8@1+ (1,0) [0|255] \"\" ECU\n"
+            << " SG_ Plain : 56|8@1+ (1,0) [0|255] \"\" ECU\n";
+    }
+
+    auto busManager = std::make_shared<CANBusManager>();
+    Parser parser(busManager);
+    parser.setThreadCount(1);
+    auto message = parser.loadDBC(path) ? busManager->getBuses().begin()->second->getMessageById(100) : nullptr;
+    std::filesystem::remove(path);
+    if (!message) {
+        report("Could not load the test file");
+    }
+    else {
+        checkSignal(*message, "Sel", true, true);
+        checkSignal(*message, "Inner", true, true, true, 1);
+        checkSignal(*message, "Leaf", true, false, true, 2);
+        checkSignal(*message, "Plain", true);
+        for (const char* name : { "Both", "Twice", "Bare", "Huge", "Reversed" }) {
+            checkSignal(*message, name, false);
+        }
+    }
+
+    // Signals created without the parser fall back to plain signals
+    for (const char* indicator : { "mM", "mm1", "m", "m1x", "x", "m99999999999999999999999" }) {
+        CANSignal signal("Direct", 0, 8, 1.0f, 0.0f, 0.0f, 255.0f, "", 1, Unsigned, "ECU", indicator);
+        if (signal.isMultiplexor() || signal.isMultiplexed()) {
+            report(std::string("indicator ") + indicator + " not loaded as a plain signal");
+        }
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " failures" << std::endl;
+        return 1;
+    }
+    std::cout << "Malformed multiplexer indicators are rejected" << std::endl;
+    return 0;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file ParallelParseTest.cpp
+ * @brief Checks that parsing the messages of a DBC file on several threads loads the same bus as one thread.
+ *
+ * A DBC file of 3000 messages, large enough to be split into chunks, is loaded with setThreadCount(1) and
+ * setThreadCount(8). The dumps of both buses, with every field of the messages and signals, their signal
+ * table rows and the values they decode from a frame, have to be identical.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+#include "CANSignal.hpp"
+#include "Parser.hpp"
+#include "TestSupport.hpp"
+
+using namespace cantools_cpp;
+using namespace cantools_cpp::test;
+
+namespace
+{
+    constexpr size_t MessageCount = 3000;
+
+    std::string load(const std::string& path, unsigned int threadCount)
+    {
+        auto busManager = std::make_shared<CANBusManager>();
+        Parser parser(busManager);
+        parser.setThreadCount(threadCount);
+        if (!parser.loadDBC(path)) {
+            return std::string();
+        }
+        return dumpBus(*busManager->getBuses().begin()->second);
+    }
+}
+
+int main()
+{
+    std::string path = (std::filesystem::temp_directory_path() / "cantools_parallel_parse_test.dbc").string();
+    if (!writeGeneratedDbc(path, MessageCount)) {
+        std::cerr << "Could not write " << path << std::endl;
+        return 1;
+    }
+
+    std::string sequential = load(path, 1);
+    std::string parallel = load(path, 8);
+    std::filesystem::remove(path);
+
+    if (sequential.empty() || sequential.find("message") == std::string::npos) {
+        std::cerr << "Could not load the generated file" << std::endl;
+        return 1;
+    }
+    if (parallel != sequential) {
+        std::cerr << "parallel load differs from the sequential one:" << firstDifference(sequential, parallel) << std::endl;
+        return 1;
+    }
+    std::cout << "Parallel and sequential loads match (" << MessageCount << " messages)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file SignalHandleTest.cpp
+ * @brief Checks the handles carried by the signal notifications of the buses.
+ *
+ * Frames are received for every message of the bundled DBC files; each notified handle must resolve to
+ * the notified signal, and observers only implementing the name based callback must still be called.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "CANBusManager.hpp"
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+#include "CANSignal.hpp"
+#include "IBusManagerObserver.hpp"
+#include "Parser.hpp"
+
+using namespace cantools_cpp;
+
+namespace
+{
+    constexpr int MaxReported = 20;
+
+    int failures = 0;
+
+    void report(const std::string& what)
+    {
+        if (++failures <= MaxReported) {
+            std::cerr << what << std::endl;
+        }
+    }
+
+    // Observer relying on the default forwarding to the name based callback
+    class NameObserver : public IBusManagerObserver {
+    public:
+        void updateMessage(const std::string&, uint32_t) override {}
+        void updateSignal(const std::string&, uint32_t, const std::string&) override { ++count; }
+
+        size_t count = 0;
+    };
+
+    // Observer identifying the signals by handle
+    class HandleObserver : public IBusManagerObserver {
+    public:
+        explicit HandleObserver(const CANBusManager& busManager) : _busManager(busManager) {}
+
+        void updateMessage(const std::string&, uint32_t) override {}
+        void updateSignal(const std::string&, uint32_t, const std::string&) override { report("name based callback called instead of the handle one"); }
+
+        void updateSignal(SignalHandle signal, const std::string& busName, uint32_t messageId, const std::string& signalName) override {
+            ++count;
+            CANBus* bus = _busManager.getBus(BusHandle{ signal.bus });
+            CANMessage* message = _busManager.getMessage(MessageHandle{ signal.bus, signal.message });
+            CANSignal* canSignal = _busManager.getSignal(signal);
+            if (!bus || bus->getName() != busName || !message || message->getId() != messageId || !canSignal || canSignal->getName() != signalName) {
+                report("handle mismatch: bus=" + busName + " message=" + std::to_string(messageId) + " signal=" + signalName);
+            }
+        }
+
+        size_t count = 0;
+
+    private:
+        const CANBusManager& _busManager;
+    };
+}
+
+int main(int argc, char** argv)
+{
+    auto busManager = std::make_shared<CANBusManager>();
+    Parser parser(busManager);
+    for (int i = 1; i < argc; ++i) {
+        if (!parser.loadDBC(argv[i])) {
+            report(std::string("Could not load ") + argv[i]);
+        }
+    }
+
+    NameObserver nameObserver;
+    HandleObserver handleObserver(*busManager);
+    size_t signalCount = 0;
+    for (CANBus& bus : busManager->getBusView()) {
+        bus.addObserver(&nameObserver);
+        bus.addObserver(&handleObserver);
+
+        for (CANMessage& message : bus.getMessageView()) {
+            std::vector<uint8_t> frame(static_cast<size_t>(message.getLength()), 0x5a);
+            bus.receiveFrame(message.getId(), frame.data(), message.getLength());
+            signalCount += message.getSignals().size();
+        }
+    }
+
+    if (handleObserver.count == 0 || handleObserver.count != nameObserver.count || handleObserver.count > signalCount) {
+        report("notifications: " + std::to_string(handleObserver.count) + " by handle, " + std::to_string(nameObserver.count) + " by name, "
+            + std::to_string(signalCount) + " signals");
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " failures" << std::endl;
+        return 1;
+    }
+    std::cout << handleObserver.count << " signal notifications carried valid handles" << std::endl;
+    return 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file TestSupport.hpp
+ * @brief Helpers shared by the tests: signal masks, multiplexor values selecting each branch, generated DBC files and
+ *        bus dumps.
+ *
+ * @author Long Pham
+ * @date 10/17/2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "CANBus.hpp"
+#include "CANMessage.hpp"
+#include "CANSignal.hpp"
+
+namespace cantools_cpp
+{
+    namespace test
+    {
+        /**
+         * @brief Returns the mask covering the raw values of a signal.
+         */
+        inline uint64_t rawMask(const CANSignal& signal)
+        {
+            return signal.getLength() >= 64 ? ~0ULL : (1ULL << signal.getLength()) - 1;
+        }
+
+        /**
+         * @brief Returns, for each multiplexor of a message, the raw values selecting one of its branches.
+         *
+         * Random multiplexor values would rarely select a branch, tests pick most of them from here instead.
+         */
+        inline std::map<const CANSignal*, std::vector<uint64_t>> branchValues(const CANMessage& message)
+        {
+            std::map<const CANSignal*, std::vector<uint64_t>> values;
+            for (const auto& signal : message.getSignals()) {
+                auto multiplexor = signal->isMultiplexed() ? signal->getMultiplexorSignal() : nullptr;
+                if (multiplexor) {
+                    for (const MultiplexerRange& range : signal->getMultiplexerValues()) {
+                        values[multiplexor.get()].push_back(range.low);
+                        values[multiplexor.get()].push_back(range.high);
+                    }
+                }
+            }
+            return values;
+        }
+
+        /**
+         * @brief Draws a random raw value for a signal, selecting a multiplexer branch three times out of four.
+         */
+        template <typename Engine>
+        uint64_t randomRaw(const CANSignal& signal, const std::map<const CANSignal*, std::vector<uint64_t>>& branches, Engine& engine)
+        {
+            uint64_t value = engine() & rawMask(signal);
+            auto branch = branches.find(&signal);
+            if (branch != branches.end() && engine() % 4 != 0) {
+                value = branch->second[engine() % branch->second.size()] & rawMask(signal);
+            }
+            return value;
+        }
+
+        /**
+         * @brief Writes a DBC file of a given number of messages, for tests and benchmarks on large files.
+         *
+         * Every message has plain, scaled, Motorola, float and multiplexed signals. Messages with an
+         * extended ID, one in ten and all those beyond the standard range, have additional transmitters;
+         * one message in four has a multiplexer value list.
+         *
+         * @return false if the file could not be written.
+         */
+        inline bool writeGeneratedDbc(const std::string& path, size_t messageCount)
+        {
+            std::ofstream file(path);
+            file << "VERSION \"\"\n\n\nNS_ : \n\nBS_:\n\nBU_: ECU1 ECU2 ECU3\n\n";
+
+            // As in the files written by the usual tools, the BO_TX_BU_, SIG_VALTYPE_ and SG_MUL_VAL_ statements
+            // follow all the messages, which form a single run of BO_ and SG_ statements
+            std::string transmitters;
+            std::string valueTypes;
+            std::string multiplexerValues;
+            for (size_t i = 0; i < messageCount; ++i) {
+                bool extended = i % 10 == 9 || i >= 0x7FF;
+                uint32_t id = extended ? 0x80000000u | static_cast<uint32_t>(0x18FF0000 + i) : static_cast<uint32_t>(i);
+                std::string name = "Message_" + std::to_string(i);
+                file << "BO_ " << id << " " << name << ": 8 ECU" << (i % 3 + 1) << "\n"
+                    << " SG_ Mode M : 0|4@1+ (1,0) [0|15] \"\" ECU2\n"
+                    << " SG_ Low m0 : 8|16@1+ (1,0) [0|65535] \"\" ECU2\n"
+                    << " SG_ High m1 : 8|16@1- (0.5,-100) [-16484|16283.5] \"rpm\" ECU2,ECU3\n"
+                    << " SG_ Speed : 31|8@0+ (0.5,0) [0|127.5] \"km/h\" ECU3\n"
+                    << " SG_ Flag : 4|1@1+ (1,0) [0|1] \"\" Vector__XXX\n"
+                    << " SG_ Ratio : 32|32@1- (1,0) [-3.4E+038|3.4E+038] \"\" ECU2\n\n";
+                valueTypes += "SIG_VALTYPE_ " + std::to_string(id) + " Ratio : 1;\n";
+                if (extended) {
+                    transmitters += "BO_TX_BU_ " + std::to_string(id) + " : ECU2,ECU3;\n";
+                }
+                if (i % 4 == 0) {
+                    multiplexerValues += "SG_MUL_VAL_ " + std::to_string(id) + " High Mode 1-1, 3-5;\n";
+                }
+            }
+            file << transmitters << "\n" << valueTypes << "\n" << multiplexerValues;
+            return static_cast<bool>(file);
+        }
+
+        /**
+         * @brief Dumps a bus as text, to compare buses loaded in different ways.
+         *
+         * The dump holds the nodes, every field of the messages and signals, the signal table rows and the
+         * values the signals decode from a frame derived from the message ID; the frame is set on the messages.
+         */
+        inline std::string dumpBus(CANBus& bus)
+        {
+            std::ostringstream dump;
+            dump << "bus " << bus.getName() << "\n";
+            for (const auto& node : bus.getNodes()) {
+                dump << "node " << node->getName() << "\n";
+            }
+
+            for (const auto& message : bus.getAllMessages()) {
+                dump << "message " << message->getId() << " " << message->getName() << " " << message->getLength() << " " << message->getTransmitter();
+                for (const std::string& transmitter : message->getAdditionalTransmitters()) {
+                    dump << " " << transmitter;
+                }
+                dump << (bus.getMessageById(message->getId()) == message ? "" : " not indexed") << "\n";
+
+                std::vector<uint8_t> frame(static_cast<size_t>(message->getLength()));
+                for (size_t i = 0; i < frame.size(); ++i) {
+                    frame[i] = static_cast<uint8_t>(message->getId() * 31 + i * 7);
+                }
+                message->setData(frame.data(), message->getLength());
+
+                for (const auto& signal : message->getSignals()) {
+                    dump << "  signal " << signal->getPosition() << " " << signal->getName() << " " << int(signal->getStartBit()) << "|"
+                        << int(signal->getLength()) << "@" << int(signal->getByteOrder()) << " " << signal->getValueType() << " ("
+                        << signal->getFactor() << "," << signal->getOffset() << ") [" << signal->getMinVal() << "|" << signal->getMaxVal() << "] \""
+                        << signal->getUnit() << "\" " << signal->getReceiver() << " mux '" << signal->getMultiplexer() << "' "
+                        << signal->getMultiplexorName();
+                    for (const MultiplexerRange& range : signal->getMultiplexerValues()) {
+                        dump << " " << range.low << "-" << range.high;
+                    }
+                    dump << " row " << signal->getRow() << (signal->getSignalTable() == bus.getSignalTable() ? "" : " in another table")
+                        << " raw " << signal->getRawValue() << " physical " << signal->getPhysicalValue() << " active " << signal->isActive() << "\n";
+                }
+            }
+            return dump.str();
+        }
+
+        /**
+         * @brief Describes the first line that differs between two dumps.
+         */
+        inline std::string firstDifference(const std::string& expected, const std::string& actual)
+        {
+            std::istringstream expectedLines(expected);
+            std::istringstream actualLines(actual);
+            std::string expectedLine;
+            std::string actualLine;
+            while (std::getline(expectedLines, expectedLine) && std::getline(actualLines, actualLine) && expectedLine == actualLine) {
+            }
+            return "\n  expected: " + expectedLine + "\n  actual:   " + actualLine;
+        }
+    }
+}
@@ -12,13 +12,13 @@
 
 BusManager::BusManager(){}
 
-void BusManager::updateMessage(std::string busName, uint32_t messageId)
+void BusManager::updateMessage(const std::string& busName, uint32_t messageId)
 {
     cantools_cpp::Logger::getInstance().log("[BusManager][" + busName + "] Message " + std::to_string(messageId) + " is updated ");
     notifyObserversAboutMessage(busName, messageId);
 }
 
-void BusManager::updateSignal(std::string busName, uint32_t messageId, std::string signalName)
+void BusManager::updateSignal(const std::string& busName, uint32_t messageId, const std::string& signalName)
 {
     cantools_cpp::Logger::getInstance().log("[BusManager][" + busName + "] Signal " + signalName + " from message " + std::to_string(messageId) + " is updated ");
     notifyObserversAboutSignal(busName, messageId, signalName);
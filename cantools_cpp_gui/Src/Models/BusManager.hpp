@@ -24,8 +24,8 @@ public:
         _observers.erase(std::remove(_observers.begin(), _observers.end(), observer), _observers.end());
     }
 
-    virtual void updateMessage(std::string busName, uint32_t messageId) override;
-    virtual void updateSignal(std::string busName, uint32_t messageId, std::string signalName) override;
+    virtual void updateMessage(const std::string& busName, uint32_t messageId) override;
+    virtual void updateSignal(const std::string& busName, uint32_t messageId, const std::string& signalName) override;
 
     virtual bool createBus(const std::string& busName) override;
 
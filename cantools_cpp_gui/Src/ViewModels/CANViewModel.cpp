@@ -32,8 +32,8 @@ void CANViewModel::loadCANData(std::string filePath)
 
         if (observerTabDataBaseView) {
             auto bus = _busManager->getBus(busName);
-            auto nodes = bus->getNodes();
-            auto messages = bus->getAllMessages();
+            const auto& nodes = bus->getNodes();
+            const auto& messages = bus->getAllMessages();
             observerTabDataBaseView->Update(nodes, messages, busName);
         }
     }
@@ -287,7 +287,7 @@ void TabDatabaseView::OnGridLabelLeftClick(wxGridEvent& event) {
         _currentBusName = busName;
 
         // Retrieve all messages
-        auto messages = bus->getAllMessages();
+        const auto& messages = bus->getAllMessages();
 
         try {
             int msgId = std::stoi(messageId, nullptr, 16);  // Convert string to int
@@ -307,7 +307,7 @@ void TabDatabaseView::OnGridLabelLeftClick(wxGridEvent& event) {
                 _signalsGrid->AppendRows((*it)->getSignals().size());
 
                 int i = 0;
-                for (auto signal : (*it)->getSignals())
+                for (const auto& signal : (*it)->getSignals())
                 {
                     _signalsGrid->SetCellValue(i, COLUMN_SIGNAL_GRID_MSG_ID, wxString::Format("0x%X", signal->getParent().lock()->getId())); // ID
                     _signalsGrid->SetCellValue(i, COLUMN_SIGNAL_GRID_NAME, signal->getName()); // Name